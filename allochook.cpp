@@ -0,0 +1,41 @@
+#include "allochook.h"
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// countedAlloc()
+// Reports one allocation and makes it.
+// Input: size and alignment (0 for the default). Output: memory, or null.
+void *countedAlloc(std::size_t size, std::size_t alignment)
+{
+    AllocHook::counted(size);
+    if (size == 0) size = 1;
+    if (alignment <= alignof(std::max_align_t)) return std::malloc(size);
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+} // anonymous namespace
+
+void *operator new(std::size_t size)
+{
+    if (void *p = countedAlloc(size, 0)) return p;
+    throw std::bad_alloc();
+}
+void *operator new[](std::size_t size) { return operator new(size); }
+void *operator new(std::size_t size, std::align_val_t al)
+{
+    if (void *p = countedAlloc(size, static_cast<std::size_t>(al))) return p;
+    throw std::bad_alloc();
+}
+void *operator new[](std::size_t size, std::align_val_t al) { return operator new(size, al); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return countedAlloc(size, 0); }
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return countedAlloc(size, 0); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+void operator delete(void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept { std::free(p); }
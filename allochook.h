@@ -0,0 +1,21 @@
+#ifndef ALLOCHOOK_H
+#define ALLOCHOOK_H
+
+#include <cstddef>
+
+// Replacement global operator new and delete for binaries that count heap allocations. Linking
+// allochook.cpp replaces every form of new (plain, array, aligned, nothrow) and the matching
+// deletes, all on malloc and free. Each allocation is reported to AllocHook::counted() first,
+// which the binary defines: the profiling build (SUMMER_ALLOCS in profile.cpp) charges it to the
+// current phase, and microbench counts it per benchmarked call.
+namespace AllocHook {
+
+// counted()
+// Called once for every allocation, before the memory is made, on the allocating thread. It may
+// run before main() and after static destructors, so it must not allocate.
+// Input: requested size in bytes. Output: none.
+void counted(std::size_t size);
+
+} // namespace AllocHook
+
+#endif // ALLOCHOOK_H
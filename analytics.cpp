@@ -0,0 +1,195 @@
+#include "analytics.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace Analytics {
+
+namespace {
+
+const char *const kStatNames[Report::kStats] = {"energy", "health", "social", "academic", "fitness", "money"};
+
+const char *const kCauseNames[Report::kCauses] = {
+    "",
+    "ran out of money during the summer",
+    "health at 0 at the final check",
+    "energy at 0 at the final check",
+    "money at 0 at the final check",
+    "ended by a story event",
+};
+
+// Stats run 0-100 in steps of 1; money is kept in $10 bins up to $5000.
+const int kStatBins = 101;
+const int kMoneyBins = 501;
+const int kMoneyWidth = 10;
+
+// statValue()
+// Returns one of the player's stats by index (kStatNames order).
+int statValue(const Player &p, int stat)
+{
+    switch (stat) {
+    case 0: return p.energy;
+    case 1: return p.health;
+    case 2: return p.social;
+    case 3: return p.academic;
+    case 4: return p.fitness;
+    default: return p.money;
+    }
+}
+
+// line()
+// Prints a name, a count, and its share of a total as one aligned row.
+void line(OutputSink &sink, std::string_view name, uint64_t count, uint64_t total)
+{
+    char row[128];
+    double percent = total ? 100.0 * static_cast<double>(count) / static_cast<double>(total) : 0.0;
+    int n = std::snprintf(row, sizeof(row), "  %-40.*s %12llu %6.2f%%\n", static_cast<int>(name.size()), name.data(),
+                          static_cast<unsigned long long>(count), percent);
+    sink << std::string_view(row, n > 0 ? std::min(static_cast<size_t>(n), sizeof(row) - 1) : 0);
+}
+
+} // anonymous namespace
+
+// Histogram::Histogram()
+Histogram::Histogram(int bins, int width_) : width(width_ > 0 ? width_ : 1), counts(static_cast<size_t>(std::max(bins, 1)))
+{
+}
+
+// Histogram::add()
+// Clamps into the first or last bin.
+void Histogram::add(int value)
+{
+    int bin = std::clamp(value / width, 0, static_cast<int>(counts.size()) - 1);
+    counts[bin]++;
+    total++;
+}
+
+// Histogram::merge()
+void Histogram::merge(const Histogram &other)
+{
+    size_t bins = std::min(counts.size(), other.counts.size());
+    for (size_t i = 0; i < bins; ++i) counts[i] += other.counts[i];
+    total += other.total;
+}
+
+// Histogram::quantile()
+// Walks the bins until the running count passes q of the total.
+int Histogram::quantile(double q) const
+{
+    if (total == 0) return 0;
+    uint64_t rank = static_cast<uint64_t>(std::clamp(q, 0.0, 1.0) * static_cast<double>(total - 1));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < counts.size(); ++i) {
+        seen += counts[i];
+        if (seen > rank) return static_cast<int>(i) * width;
+    }
+    return static_cast<int>(counts.size() - 1) * width;
+}
+
+// Report::Report()
+// Sets up one histogram per stat per week.
+Report::Report()
+{
+    weekly.reserve(static_cast<size_t>((kSummerWeeks + 1) * kStats));
+    for (int week = 0; week <= kSummerWeeks; ++week) {
+        for (int stat = 0; stat < kStats; ++stat) {
+            weekly.emplace_back(stat == 5 ? kMoneyBins : kStatBins, stat == 5 ? kMoneyWidth : 1);
+        }
+    }
+}
+
+// Report::addGame()
+void Report::addGame(const Outcome &outcome)
+{
+    finished++;
+    if (outcome.gameOver) {
+        int cause = static_cast<int>(outcome.cause);
+        if (cause > 0 && cause < kCauses) causes[cause]++;
+    } else {
+        survived++;
+        endings[outcome.ending]++;
+        if (outcome.stars >= 0 && outcome.stars <= 5) ratings[outcome.stars]++;
+    }
+    paths[outcome.path.empty() ? std::string_view("other") : outcome.path]++;
+    hospitalVisits += static_cast<uint64_t>(outcome.hospitalVisits);
+    collapses += static_cast<uint64_t>(outcome.collapses);
+    if (outcome.hospitalVisits > 0) gamesWithHospital++;
+    if (outcome.collapses > 0) gamesWithCollapse++;
+}
+
+// Report::addWeek()
+void Report::addWeek(int week, const Player &player)
+{
+    if (week < 1 || week > kSummerWeeks) return;
+    for (int stat = 0; stat < kStats; ++stat) weekly[week * kStats + stat].add(statValue(player, stat));
+}
+
+// Report::merge()
+void Report::merge(const Report &other)
+{
+    finished += other.finished;
+    survived += other.survived;
+    for (int i = 0; i < 6; ++i) ratings[i] += other.ratings[i];
+    for (int i = 0; i < kCauses; ++i) causes[i] += other.causes[i];
+    hospitalVisits += other.hospitalVisits;
+    collapses += other.collapses;
+    gamesWithHospital += other.gamesWithHospital;
+    gamesWithCollapse += other.gamesWithCollapse;
+    for (const auto &entry : other.endings) endings[entry.first] += entry.second;
+    for (const auto &entry : other.paths) paths[entry.first] += entry.second;
+    for (size_t i = 0; i < weekly.size(); ++i) weekly[i].merge(other.weekly[i]);
+}
+
+// Report::rated()
+uint64_t Report::rated(int stars) const
+{
+    uint64_t count = 0;
+    for (int i = std::clamp(stars, 0, 5); i <= 5; ++i) count += ratings[i];
+    return count;
+}
+
+// Report::print()
+// Shares are of all finished games, except endings and ratings, which are of the survivors.
+void Report::print(OutputSink &sink) const
+{
+    sink << "Endings (" << survived << " survivors):\n";
+    for (const auto &entry : endings) line(sink, entry.first, entry.second, survived);
+    sink << "Ratings:\n";
+    for (int stars = 5; stars >= 0; --stars) {
+        char name[16];
+        std::snprintf(name, sizeof(name), "%d stars", stars);
+        line(sink, name, ratings[stars], survived);
+    }
+    sink << "Game over causes (" << finished - survived << " of " << finished << " games):\n";
+    for (int cause = 1; cause < kCauses; ++cause) line(sink, kCauseNames[cause], causes[cause], finished);
+    sink << "Critical rules:\n";
+    line(sink, "games with a forced hospital visit", gamesWithHospital, finished);
+    line(sink, "games with a collapse from exhaustion", gamesWithCollapse, finished);
+    sink << "  (" << hospitalVisits << " hospital visits and " << collapses << " collapses in total)\n";
+    sink << "Relationship paths:\n";
+    for (const auto &entry : paths) line(sink, entry.first, entry.second, finished);
+
+    sink << "Stats at the end of each week (10th / 50th / 90th percentile):\n";
+    char row[256];
+    int n = std::snprintf(row, sizeof(row), "  %4s %12s", "week", "games");
+    sink << std::string_view(row, static_cast<size_t>(n));
+    for (const char *name : kStatNames) {
+        n = std::snprintf(row, sizeof(row), " %15s", name);
+        sink << std::string_view(row, static_cast<size_t>(n));
+    }
+    sink << "\n";
+    for (int week = 1; week <= kSummerWeeks; ++week) {
+        const Histogram *stats = &weekly[week * kStats];
+        n = std::snprintf(row, sizeof(row), "  %4d %12llu", week, static_cast<unsigned long long>(stats[0].count()));
+        sink << std::string_view(row, static_cast<size_t>(n));
+        for (int stat = 0; stat < kStats; ++stat) {
+            char cell[48];
+            int c = std::snprintf(cell, sizeof(cell), "%d/%d/%d", stats[stat].quantile(0.1), stats[stat].quantile(0.5),
+                                  stats[stat].quantile(0.9));
+            n = std::snprintf(row, sizeof(row), " %15.*s", c, cell);
+            sink << std::string_view(row, static_cast<size_t>(n));
+        }
+        sink << "\n";
+    }
+}
+
+} // namespace Analytics
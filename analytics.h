@@ -0,0 +1,102 @@
+#ifndef ANALYTICS_H
+#define ANALYTICS_H
+
+#include <cstdint>
+#include <map>
+#include <string_view>
+#include <vector>
+
+#include "output.h"
+#include "player.h"
+#include "scenario.h"
+
+// What a batch of games produced, for designers: how often each ending, rating, game-over cause,
+// and relationship path came up, how often the critical rules stepped in, and the spread of every
+// stat at the end of each week. All counts are kept in fixed-size tables (stats are bounded whole
+// numbers, so each gets one bin per value), so a report uses the same memory after a hundred games
+// or a hundred million. Reports from different workers are merged at the end.
+namespace Analytics {
+
+// Histogram
+// Counts of whole numbers in equal-width bins starting at 0. Values past the last bin are counted
+// in it, negative values in the first. Quantiles are exact to the bin width.
+class Histogram {
+public:
+    // Histogram()
+    // Input: number of bins and the width of each.
+    explicit Histogram(int bins = 1, int width = 1);
+
+    // add()
+    // Counts one value. Input: value. Output: none.
+    void add(int value);
+
+    // merge()
+    // Adds another histogram with the same bins. Input: histogram. Output: none.
+    void merge(const Histogram &other);
+
+    // count()
+    // Returns the number of values counted.
+    uint64_t count() const { return total; }
+
+    // quantile()
+    // Returns the lower edge of the bin holding the q-th quantile, or 0 when nothing was counted.
+    // Input: q in [0, 1]. Output: value.
+    int quantile(double q) const;
+
+private:
+    int width;
+    std::vector<uint64_t> counts;
+    uint64_t total = 0;
+};
+
+// Report
+// Running totals over finished games.
+class Report {
+public:
+    static constexpr int kStats = 6;     // energy, health, social, academic, fitness, money
+    static constexpr int kCauses = 6;    // GameOverCause values
+
+    Report();
+
+    // addGame()
+    // Counts a game that reached its closing sequence. Input: its outcome. Output: none.
+    void addGame(const Outcome &outcome);
+
+    // addWeek()
+    // Counts the player's stats at the end of one week of one game.
+    // Input: week (1 to kSummerWeeks) and stats. Output: none.
+    void addWeek(int week, const Player &player);
+
+    // merge()
+    // Adds another report. Input: report. Output: none.
+    void merge(const Report &other);
+
+    // games()
+    // Returns the number of games counted by addGame().
+    uint64_t games() const { return finished; }
+
+    // rated()
+    // Returns the number of survivors with at least the given star rating.
+    uint64_t rated(int stars) const;
+
+    // print()
+    // Writes the report as text tables. Input: destination. Output: none.
+    void print(OutputSink &sink) const;
+
+private:
+    uint64_t finished = 0;
+    uint64_t survived = 0;
+    uint64_t ratings[6] = {};
+    uint64_t causes[kCauses] = {};
+    uint64_t hospitalVisits = 0;
+    uint64_t collapses = 0;
+    uint64_t gamesWithHospital = 0;
+    uint64_t gamesWithCollapse = 0;
+    std::map<std::string_view, uint64_t> endings; // names point at the game's static text
+    std::map<std::string_view, uint64_t> paths;   // likewise
+    std::vector<Histogram> weekly;                // [week * kStats + stat], week 0 unused
+};
+
+} // namespace Analytics
+
+#endif // ANALYTICS_H
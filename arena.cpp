@@ -0,0 +1,78 @@
+#include "arena.h"
+#include "profile.h"
+
+static thread_local std::pmr::memory_resource *currentMemory = nullptr;
+
+// Arena::Arena()
+// The first block comes from the heap once, when the arena is made.
+Arena::Arena(size_t firstBlock)
+    : first(new std::byte[firstBlock]), blocks(first.get(), firstBlock, std::pmr::new_delete_resource())
+{
+}
+
+// Arena::release()
+// Returns the extra blocks to the heap; the first block is reused.
+void Arena::release()
+{
+    blocks.release();
+    for (void *&list : freeLists) list = nullptr;
+    carved = 0;
+}
+
+// Arena::sizeClass()
+// Maps a request to its free list: the smallest power of two from 16 to 1024 that holds it, or -1
+// for large or over-aligned requests, which are never reused.
+int Arena::sizeClass(size_t bytes, size_t alignment)
+{
+    if (alignment > alignof(std::max_align_t)) return -1;
+    int cls = 0;
+    for (size_t size = 16; size < bytes; size <<= 1) {
+        if (++cls == kClasses) return -1;
+    }
+    return cls;
+}
+
+// Arena::do_allocate()
+// Reuses a freed block of the same class, or carves a new one.
+void *Arena::do_allocate(size_t bytes, size_t alignment)
+{
+    PROFILE_ARENA_ALLOC(bytes);
+    int cls = sizeClass(bytes, alignment);
+    if (cls < 0) {
+        carved += bytes;
+        return blocks.allocate(bytes, alignment);
+    }
+    if (void *reused = freeLists[cls]) {
+        freeLists[cls] = *static_cast<void **>(reused);
+        return reused;
+    }
+    size_t size = size_t(16) << cls;
+    carved += size;
+    return blocks.allocate(size, alignof(std::max_align_t));
+}
+
+// Arena::do_deallocate()
+// Small blocks go on their free list; large ones wait for release().
+void Arena::do_deallocate(void *p, size_t bytes, size_t alignment)
+{
+    int cls = sizeClass(bytes, alignment);
+    if (cls < 0) return;
+    *static_cast<void **>(p) = freeLists[cls];
+    freeLists[cls] = p;
+}
+
+// sessionMemory()
+// Falls back to the heap when no session is running on this thread.
+std::pmr::memory_resource *sessionMemory()
+{
+    return currentMemory ? currentMemory : std::pmr::new_delete_resource();
+}
+
+// setSessionMemory()
+// Swaps the thread's resource and hands back the old one.
+std::pmr::memory_resource *setSessionMemory(std::pmr::memory_resource *resource)
+{
+    std::pmr::memory_resource *previous = currentMemory;
+    currentMemory = resource;
+    return previous;
+}
@@ -0,0 +1,60 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+// Arena
+// Memory for one game. Allocation bumps a pointer through a first block owned by the arena and
+// then through larger blocks from the heap. Small blocks that the game frees (coroutine frames,
+// grown vectors) go on per-size free lists and are handed out again, so a whole game normally fits
+// in the first block. Everything is given back at once when the arena is released or destroyed:
+// ending a game costs a few frees no matter how many objects it made, and games on different
+// threads never contend for the global allocator.
+class Arena : public std::pmr::memory_resource {
+public:
+    // Arena()
+    // Input: size of the first block, which should fit a typical game.
+    explicit Arena(size_t firstBlock = 16 * 1024);
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    // release()
+    // Frees every allocation at once and rewinds to the first block. Objects still using the
+    // arena must not be touched afterwards.
+    void release();
+
+    // used()
+    // Returns the bytes carved out of the arena's blocks since it was created or last released.
+    size_t used() const { return carved; }
+
+protected:
+    void *do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void *p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+private:
+    static constexpr int kClasses = 7; // free lists for 16, 32, ..., 1024 bytes
+
+    static int sizeClass(size_t bytes, size_t alignment);
+
+    std::unique_ptr<std::byte[]> first;
+    std::pmr::monotonic_buffer_resource blocks;
+    void *freeLists[kClasses] = {};
+    size_t carved = 0;
+};
+
+// sessionMemory()
+// Returns where per-game objects on this thread allocate from: the arena of the session being
+// run, or the ordinary heap (as at the terminal).
+// Input: none. Output: memory resource.
+std::pmr::memory_resource *sessionMemory();
+
+// setSessionMemory()
+// Points this thread's per-game allocations at a resource.
+// Input: resource, or nullptr for the heap. Output: the resource that was active before.
+std::pmr::memory_resource *setSessionMemory(std::pmr::memory_resource *resource);
+
+#endif // ARENA_H
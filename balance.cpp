@@ -0,0 +1,58 @@
+#include "balance.h"
+
+namespace {
+
+// The shipped values. Decay rows are {energy, health, social, academic, fitness} per week.
+const Balance kDefaultBalance = {
+    {
+        {}, // index 0 unused
+        {0, -3, -4, -5, -6},
+        {-8, -4, -5, -6, -7},
+        {-9, -5, -6, -7, -8},
+        {-12, -8, -7, -9, -8},
+        {-8, -4, -5, -6, -5},
+        {-20, -6, -8, -7, -6},
+        {-12, -8, -10, -10, -9},
+        {-20, -12, -15, -15, -15},
+    },
+    {
+        {},
+        {Player(80, 75, 70, 40, 65, 1500), {"Easy", "Lower decay and cheaper actions", 0.85, 0.8, 50, false, 0}},
+        {Player(60, 65, 50, 50, 45, 300), {"Medium", "Standard campus grind", 1.0, 1.0, 30, true, 0}},
+        {Player(40, 60, 30, 60, 20, 100), {"Hard", "Higher decay and weekly remittance", 1.1, 1.25, 0, false, 50}},
+    },
+};
+
+} // anonymous namespace
+
+// defaultBalance()
+// Returns the shipped table.
+const Balance &defaultBalance()
+{
+    return kDefaultBalance;
+}
+
+// printBalance()
+// Writes one initializer line per decay row and per preset.
+void printBalance(OutputSink &sink, const Balance &balance)
+{
+    sink << "    {\n";
+    sink << "        {}, // index 0 unused\n";
+    for (int week = 1; week <= Balance::kWeeks; ++week) {
+        const WeekDecay &d = balance.decay[week];
+        sink << "        {" << d.energy << ", " << d.health << ", " << d.social << ", " << d.academic << ", "
+             << d.fitness << "},\n";
+    }
+    sink << "    },\n";
+    sink << "    {\n";
+    sink << "        {},\n";
+    for (int level = 1; level <= Balance::kDifficulties; ++level) {
+        const Player &p = balance.presets[level].start;
+        const DifficultySettings &s = balance.presets[level].settings;
+        sink << "        {Player(" << p.energy << ", " << p.health << ", " << p.social << ", " << p.academic << ", "
+             << p.fitness << ", " << p.money << "), {\"" << s.name << "\", \"" << s.description << "\", "
+             << s.energyCostMultiplier << ", " << s.decayMultiplier << ", " << s.weeklyAllowance << ", "
+             << (s.allowanceNeedsGrades ? "true" : "false") << ", " << s.weeklyDeduction << "}},\n";
+    }
+    sink << "    },\n";
+}
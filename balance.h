@@ -0,0 +1,91 @@
+#ifndef BALANCE_H
+#define BALANCE_H
+
+#include <string_view>
+#include <type_traits>
+
+#include "output.h"
+#include "player.h"
+#include "scenario.h"
+
+// The numbers that set how hard a game is: each week's stat decay and each difficulty's starting
+// stats and settings. The game reads them from a Balance, so automated tuning (tuning.h) can play
+// games with candidate values before they are copied back here.
+
+/**
+ * WeekDecay
+ * Represents the stat decay values applied at the end of each week.
+ * Inputs: None (data structure).
+ * Output: None (data structure).
+ */
+
+struct WeekDecay {
+    int energy = 0;
+    int health = 0;
+    int social = 0;
+    int academic = 0;
+    int fitness = 0;
+};
+
+/**
+ * DifficultySettings
+ * Stores settings for the chosen difficulty level.
+ * Inputs:
+ *  - name: string representing the difficulty level name.
+ *  - description: string describing the difficulty level.
+ *  - energyCostMultiplier: multiplier for energy costs.
+ *  - decayMultiplier: multiplier for weekly stat decay.
+ *  - weeklyAllowance: integer value for weekly allowance.
+ *  - allowanceNeedsGrades: boolean indicating if allowance is dependent on academic performance.
+ *  - weeklyDeduction: integer value for weekly money deduction.
+ * Output: None (data structure).
+ */
+
+struct DifficultySettings {
+    std::string_view name;
+    std::string_view description;
+    double energyCostMultiplier = 1.0;
+    double decayMultiplier = 1.0;
+    int weeklyAllowance = 0;
+    bool allowanceNeedsGrades = false;
+    int weeklyDeduction = 0;
+};
+
+/**
+ * DifficultyPreset
+ * Template state for a new game on one difficulty: the starting stats and the settings.
+ * Both parts are plain values, so starting a game copies the preset with a memcpy.
+ * Inputs: None (data structure).
+ * Output: None (data structure).
+ */
+
+struct DifficultyPreset {
+    Player start;
+    DifficultySettings settings;
+};
+
+static_assert(std::is_trivially_copyable_v<Player> && std::is_trivially_copyable_v<DifficultySettings>,
+              "difficulty presets are copied as raw bytes");
+
+// Balance
+// One complete set of tuning values. It is a plain value, so candidates are cheap to copy.
+struct Balance {
+    static constexpr int kWeeks = kSummerWeeks;
+    static constexpr int kDifficulties = 3;
+
+    WeekDecay decay[kWeeks + 1];                  // indexed by week; index 0 is unused
+    DifficultyPreset presets[kDifficulties + 1]; // 1 = Easy, 2 = Medium, 3 = Hard; index 0 is unused
+};
+
+// defaultBalance()
+// Returns the values the game ships with.
+// Input: none. Output: the shipped balance.
+const Balance &defaultBalance();
+
+// printBalance()
+// Prints the decay table and the presets as C++ initializers in the layout of balance.cpp, so
+// tuned values can be pasted over the shipped ones.
+// Input: destination and balance. Output: none.
+void printBalance(OutputSink &sink, const Balance &balance);
+
+#endif // BALANCE_H
@@ -0,0 +1,216 @@
+#include "batch.h"
+#include "profile.h"
+#include "scheduler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <vector>
+
+namespace Batch {
+
+namespace {
+
+const int kDecisionsPerJob = 32; // decisions one game makes before yielding its worker
+const int kGamesPerWorker = 64;  // games alive at once on each worker
+
+// Game
+// One automated game, the generator its answers are drawn from, and the answers made so far.
+struct Game {
+    Game(std::unique_ptr<Session> session_, int index_, uint32_t seed) : session(std::move(session_)), index(index_)
+    {
+        std::seed_seq answers{seed, 3u}; // apart from the game's own streams (GameRandom::seed())
+        picks.seed(answers);
+        session->seed(seed);
+    }
+
+    std::unique_ptr<Session> session;
+    int index;
+    std::mt19937 picks;
+    int decisions = 0;
+};
+
+// Tally
+// Results gathered by one worker; merged after the run so workers never share counters.
+struct Tally {
+    int survived = 0;
+    int gameOvers = 0;
+    int softlocks = 0;
+    int unfinished = 0;
+    long long stars = 0;
+    Analytics::Report report;
+    uint64_t decisions = 0;
+    Analytics::Histogram turnNanos;
+};
+
+// Run
+// Shared state of one batch: games are started as earlier ones finish, so only a bounded number
+// are alive at once and their arenas stay in cache.
+struct Run {
+    Scheduler *scheduler = nullptr;
+    std::shared_ptr<const Content::Catalog> catalog;
+    Session::Game play = nullptr;
+    const std::function<void(int, const Session &)> *finished = nullptr;
+    const Policy *policy = nullptr;
+    int games = 0;
+    int maxDecisions = 0;
+    uint32_t seed = 0;
+    bool timeTurns = false;
+    std::atomic<int> next{0};
+    std::vector<SessionPool> pools; // one per worker, used only by that worker
+    std::vector<Tally> tallies;     // likewise
+};
+
+// answer()
+// Answers the pending prompt: the policy picks scenario choices, everything else is random or default.
+void answer(const Run &run, Game &game)
+{
+    const Prompt &prompt = game.session->pendingPrompt();
+    switch (prompt.kind) {
+    case PromptKind::Choice:
+        if (prompt.decision && run.policy) {
+            game.session->submit(run.policy->choose(*prompt.decision, game.picks) + 1);
+        } else {
+            game.session->submit(std::uniform_int_distribution<int>(prompt.min, prompt.max)(game.picks));
+        }
+        break;
+    case PromptKind::Confirm:
+        game.session->submit("n");
+        break;
+    case PromptKind::Continue:
+        game.session->submit("");
+        break;
+    case PromptKind::Number:
+        game.session->submit(0);
+        break;
+    case PromptKind::None:
+        break;
+    }
+}
+
+// finish()
+// Records how a game ended and returns its session to the worker's pool.
+void finish(Run &run, Game &game, bool softlocked)
+{
+    Tally &tally = run.tallies[Scheduler::currentWorker()];
+    tally.decisions += static_cast<uint64_t>(game.decisions);
+    const Outcome *outcome = game.session->outcome();
+    if (softlocked) {
+        tally.softlocks++;
+    } else if (!outcome) {
+        tally.unfinished++;
+    } else if (outcome->gameOver) {
+        tally.gameOvers++;
+    } else {
+        tally.survived++;
+        tally.stars += outcome->stars;
+    }
+    if (outcome) tally.report.addGame(*outcome);
+    for (int week = 1; week <= kSummerWeeks; ++week) {
+        if (const Player *stats = game.session->weekStats(week)) tally.report.addWeek(week, *stats);
+    }
+    if (*run.finished) (*run.finished)(game.index, *game.session);
+    run.pools[Scheduler::currentWorker()].recycle(std::move(game.session));
+}
+
+void advance(Run &run, std::shared_ptr<Game> game);
+
+// startNext()
+// Starts the next unplayed game, if any, on the calling worker.
+void startNext(Run &run)
+{
+    int index = run.next++;
+    if (index >= run.games) return;
+    SessionPool &pool = run.pools[Scheduler::currentWorker()];
+    std::shared_ptr<Game> game;
+    {
+        PROFILE_SCOPE(SessionSetup);
+        game = std::make_shared<Game>(pool.acquire(run.catalog, run.play, false), index,
+                                      run.seed + static_cast<uint32_t>(index));
+    }
+    game->session->start();
+    advance(run, std::move(game));
+}
+
+// advance()
+// Runs a slice of one game, then queues the next slice on the same worker; a finished game hands
+// its slot to the next one.
+void advance(Run &run, std::shared_ptr<Game> game)
+{
+    int made = 0;
+    while (!game->session->isFinished() && made < kDecisionsPerJob && game->decisions < run.maxDecisions) {
+        if (run.timeTurns) {
+            auto begin = std::chrono::steady_clock::now();
+            answer(run, *game);
+            auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin);
+            run.tallies[Scheduler::currentWorker()].turnNanos.add(static_cast<int>(
+                std::min<long long>(nanos.count(), static_cast<long long>(kTurnBins) * kTurnBinNanos)));
+        } else {
+            answer(run, *game);
+        }
+        ++made;
+        ++game->decisions;
+    }
+    bool softlocked = !game->session->isFinished() && game->decisions >= run.maxDecisions;
+    if (game->session->isFinished() || softlocked) {
+        finish(run, *game, softlocked);
+        game.reset();
+        PROFILE_SCOPE(Schedule);
+        run.scheduler->post([&run]() { startNext(run); });
+    } else {
+        PROFILE_SCOPE(Schedule);
+        run.scheduler->post([&run, game]() { advance(run, game); });
+    }
+}
+
+} // anonymous namespace
+
+// Batch::run()
+// Keeps kGamesPerWorker games in flight on each worker until every game has been played, then
+// adds up the workers' tallies.
+Result run(const Options &options, std::shared_ptr<const Content::Catalog> catalog, Session::Game game)
+{
+    Result result;
+    result.games = options.games;
+    Run run;
+    run.catalog = std::move(catalog);
+    run.play = game;
+    run.policy = options.policy;
+    run.games = options.games;
+    run.maxDecisions = options.maxDecisions;
+    run.seed = options.seed ? options.seed : std::random_device{}();
+    run.timeTurns = options.timeTurns;
+    run.finished = &options.finished;
+    auto begin = std::chrono::steady_clock::now();
+    {
+        Scheduler scheduler(options.threads);
+        run.scheduler = &scheduler;
+        for (int i = 0; i < scheduler.size(); ++i) run.pools.emplace_back(kGamesPerWorker);
+        run.tallies.resize(static_cast<size_t>(scheduler.size()));
+        if (run.timeTurns) {
+            for (Tally &tally : run.tallies) tally.turnNanos = Analytics::Histogram(kTurnBins, kTurnBinNanos);
+            result.turnNanos = Analytics::Histogram(kTurnBins, kTurnBinNanos);
+        }
+        for (int i = 0; i < scheduler.size() * kGamesPerWorker && i < options.games; ++i) {
+            scheduler.post([&run]() { startNext(run); }, i % scheduler.size());
+        }
+        scheduler.wait();
+        Scheduler::Stats stats = scheduler.stats();
+        result.jobs = stats.executed;
+        result.stolen = stats.stolen;
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    for (const Tally &tally : run.tallies) {
+        result.survived += tally.survived;
+        result.gameOvers += tally.gameOvers;
+        result.softlocks += tally.softlocks;
+        result.unfinished += tally.unfinished;
+        result.stars += tally.stars;
+        result.decisions += tally.decisions;
+        result.report.merge(tally.report);
+        result.turnNanos.merge(tally.turnNanos);
+    }
+    return result;
+}
+
+} // namespace Batch
@@ -0,0 +1,62 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "analytics.h"
+#include "catalog.h"
+#include "policy.h"
+#include "session.h"
+
+// Batch runs: many automated games played headless on a Scheduler. Each game is a Session that
+// advances a few decisions per job and then re-posts itself, so the games share the workers fairly
+// and each stays on the core that last ran it unless another core steals it. A fixed number of
+// games is in flight per worker; each finished game starts the next one.
+namespace Batch {
+
+// Turn times are kept in 100 ns bins up to 10 ms; slower turns are counted in the last bin.
+constexpr int kTurnBinNanos = 100;
+constexpr int kTurnBins = 100000;
+
+struct Options {
+    int games = 0;
+    int threads = 0;                 // scheduler workers; 0 means one per CPU
+    const Policy *policy = nullptr;  // plays scenario choices; null picks at random
+    int maxDecisions = 2000;         // a game still running after this many answers is a softlock
+    uint32_t seed = 0;               // game i is seeded with seed + i; 0 picks a seed at random
+    bool timeTurns = false;          // fill Result::turnNanos
+    // Called on the worker thread as each game ends (finished, softlocked, or stopped), with the
+    // game's index and its session, before the session is reused. Calls for different games may
+    // run at the same time.
+    std::function<void(int game, const Session &session)> finished;
+};
+
+struct Result {
+    int games = 0;
+    int survived = 0;                  // reached an ending
+    int gameOvers = 0;                 // did not survive
+    int softlocks = 0;                 // gave up after Options::maxDecisions
+    int unfinished = 0;                // stopped without reporting an outcome
+    long long stars = 0;               // total rating of the survivors
+    Analytics::Report report;          // endings, ratings, causes, paths, weekly stats
+    uint64_t decisions = 0;            // prompts answered across all games
+    uint64_t jobs = 0;                 // scheduler jobs run
+    uint64_t stolen = 0;               // jobs that moved to another worker
+    Analytics::Histogram turnNanos;    // time each answer took to play to the next prompt, in
+                                       // kTurnBinNanos bins; empty unless Options::timeTurns
+    double seconds = 0.0;
+};
+
+// run()
+// Plays the requested number of games. Each game has its own random streams (Session::seed()), and
+// so do the bot's answers, so two runs with the same seed and policy play the same games. Scenario choices come from the policy; other prompts get a
+// random valid answer (difficulty and in-script questions), "no" (save prompts), or Enter.
+// Input: options, content snapshot, and the game function. Output: totals for the run.
+Result run(const Options &options, std::shared_ptr<const Content::Catalog> catalog, Session::Game game);
+
+} // namespace Batch
+
+#endif // BATCH_H
@@ -0,0 +1,404 @@
+#include "catalog.h"
+#include "content.h"
+#include "pack.h"
+#include "profile.h"
+#include "trace.h"
+#include "util.h"
+#include <cstdint>
+#include <cstring>
+#include <limits.h>
+#include <fcntl.h>
+#include <sys/inotify.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+static_assert(std::is_trivially_copyable<Script::Instr>::value && sizeof(Script::Instr) == 16,
+              "Script::Instr is stored raw in content packs");
+
+namespace {
+
+// Checks that a record array lies inside the pack and is aligned for its type.
+template <typename T>
+bool sectionFits(uint32_t count, uint32_t offset, size_t size)
+{
+    return offset % alignof(T) == 0 && offset <= size &&
+           static_cast<uint64_t>(count) * sizeof(T) <= size - offset;
+}
+
+template <typename T>
+const T *section(const char *data, uint32_t offset)
+{
+    return reinterpret_cast<const T *>(data + offset);
+}
+
+// Splits "dir/name" into its directory ("." when there is none) and file name.
+void splitPath(const std::string &path, std::string &dir, std::string &name)
+{
+    size_t slash = path.find_last_of('/');
+    dir = slash == std::string::npos ? "." : path.substr(0, slash);
+    name = slash == std::string::npos ? path : path.substr(slash + 1);
+    if (dir.empty()) dir = "/";
+}
+
+// True if a was modified strictly after b, to the nanosecond, so an edit made in the same second
+// as the pack build still counts.
+bool newerThan(const struct stat &a, const struct stat &b)
+{
+    if (a.st_mtim.tv_sec != b.st_mtim.tv_sec) return a.st_mtim.tv_sec > b.st_mtim.tv_sec;
+    return a.st_mtim.tv_nsec > b.st_mtim.tv_nsec;
+}
+
+} // anonymous namespace
+
+namespace Content {
+
+// Catalog::~Catalog()
+// Unmaps the pack file if the catalog was opened from disk.
+Catalog::~Catalog()
+{
+    if (mapped) munmap(mapped, mappedSize);
+}
+
+// Catalog::openPack()
+// Maps the whole file read-only. The mapping stays valid even if packc later replaces the file,
+// because packc writes a new file and renames it over the old one.
+// Input: pack path and error string. Output: catalog, or null with an error message.
+std::shared_ptr<const Catalog> Catalog::openPack(const std::string &path, std::string &error)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = path + ": could not open content pack";
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Pack::Header))) {
+        close(fd);
+        error = path + ": not a content pack";
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        error = path + ": could not map content pack";
+        return nullptr;
+    }
+
+    std::shared_ptr<Catalog> catalog(new Catalog());
+    catalog->mapped = data;
+    catalog->mappedSize = size;
+    if (!catalog->bind(static_cast<const char *>(data), size, error)) {
+        error = path + ": " + error;
+        return nullptr;
+    }
+    return catalog;
+}
+
+// Catalog::fromPack()
+// Keeps the bytes inside the catalog so the views stay valid.
+// Input: pack bytes and error string. Output: catalog, or null with an error message.
+std::shared_ptr<const Catalog> Catalog::fromPack(std::vector<char> bytes, std::string &error)
+{
+    std::shared_ptr<Catalog> catalog(new Catalog());
+    catalog->owned = std::move(bytes);
+    if (!catalog->bind(catalog->owned.data(), catalog->owned.size(), error)) return nullptr;
+    return catalog;
+}
+
+// Catalog::bind()
+// Checks the header and every cross-reference once, so loadWeek() can trust the records later.
+// Input: pack bytes, size, and error string. Output: true if the pack is valid.
+bool Catalog::bind(const char *data, size_t size, std::string &error)
+{
+    Pack::Header &h = header;
+    if (size < sizeof(h)) {
+        error = "not a content pack";
+        return false;
+    }
+    std::memcpy(&h, data, sizeof(h));
+    if (std::memcmp(h.magic, Pack::kMagic, sizeof(h.magic)) != 0) {
+        error = "not a content pack";
+        return false;
+    }
+    if (h.version != Pack::kVersion || h.instrSize != sizeof(Script::Instr)) {
+        error = "content pack was built by a different version of the game";
+        return false;
+    }
+    if (!sectionFits<Pack::WeekRecord>(h.weekCount, h.weekOffset, size) ||
+        !sectionFits<Pack::ScenarioRecord>(h.scenarioCount, h.scenarioOffset, size) ||
+        !sectionFits<Pack::ChoiceRecord>(h.choiceCount, h.choiceOffset, size) ||
+        !sectionFits<Pack::AffinityRecord>(h.affinityCount, h.affinityOffset, size) ||
+        !sectionFits<Script::Instr>(h.codeCount, h.codeOffset, size) ||
+        !sectionFits<Script::EventRef>(h.eventCount, h.eventOffset, size) ||
+        !sectionFits<Script::StringRef>(h.stringCount, h.stringOffset, size) ||
+        !sectionFits<char>(h.textSize, h.textOffset, size)) {
+        error = "content pack is truncated";
+        return false;
+    }
+
+    base = data;
+    weeks = section<Pack::WeekRecord>(data, h.weekOffset);
+    scenarioRecords = section<Pack::ScenarioRecord>(data, h.scenarioOffset);
+    choiceRecords = section<Pack::ChoiceRecord>(data, h.choiceOffset);
+    affinityRecords = section<Pack::AffinityRecord>(data, h.affinityOffset);
+    image.code = section<Script::Instr>(data, h.codeOffset);
+    image.codeSize = h.codeCount;
+    image.strings = section<Script::StringRef>(data, h.stringOffset);
+    image.stringCount = h.stringCount;
+    image.text = data + h.textOffset;
+    image.events = section<Script::EventRef>(data, h.eventOffset);
+    image.eventCount = h.eventCount;
+
+    for (size_t i = 0; i < image.stringCount; ++i) {
+        const Script::StringRef &ref = image.strings[i];
+        if (ref.offset > h.textSize || ref.length > h.textSize - ref.offset) {
+            error = "content pack has a bad string table";
+            return false;
+        }
+    }
+    if (!Script::verify(image, error)) return false;
+
+    auto validString = [&](uint32_t id) { return id < h.stringCount; };
+    auto validEntry = [&](uint32_t pc) { return pc == Pack::kNone || pc < h.codeCount; };
+    auto validRange = [](uint32_t first, uint32_t count, uint32_t total) {
+        return first <= total && count <= total - first;
+    };
+
+    for (uint32_t w = 0; w < h.weekCount; ++w) {
+        const Pack::WeekRecord &wr = weeks[w];
+        if (!validRange(wr.firstScenario, wr.scenarioCount, h.scenarioCount) || wr.textBegin > wr.textEnd ||
+            wr.textEnd > h.textSize || wr.codeBegin > wr.codeEnd || wr.codeEnd > h.codeCount) {
+            error = "content pack has a bad week record";
+            return false;
+        }
+    }
+    for (uint32_t s = 0; s < h.scenarioCount; ++s) {
+        const Pack::ScenarioRecord &sr = scenarioRecords[s];
+        if (!validString(sr.location) || !validString(sr.prompt) ||
+            !validRange(sr.firstChoice, sr.choiceCount, h.choiceCount)) {
+            error = "content pack has a bad scenario record";
+            return false;
+        }
+    }
+    for (uint32_t c = 0; c < h.choiceCount; ++c) {
+        const Pack::ChoiceRecord &cr = choiceRecords[c];
+        if (!validString(cr.title) || !validString(cr.detail) || !validString(cr.lockReason) ||
+            !validEntry(cr.scriptPc) || !validEntry(cr.whenPc) ||
+            !validRange(cr.firstAffinity, cr.affinityCount, h.affinityCount)) {
+            error = "content pack has a bad choice record";
+            return false;
+        }
+    }
+    for (uint32_t a = 0; a < h.affinityCount; ++a) {
+        if (!validString(affinityRecords[a].npc)) {
+            error = "content pack has a bad affinity record";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Catalog::findWeek()
+// Returns the week's record, or null if the pack has no scenarios for that week.
+const Pack::WeekRecord *Catalog::findWeek(int week) const
+{
+    for (uint32_t w = 0; w < header.weekCount; ++w) {
+        if (weeks[w].week == week) return &weeks[w];
+    }
+    return nullptr;
+}
+
+// Catalog::adviseWeek()
+// Passes a madvise() hint for the week's text and bytecode ranges. Only whole pages inside a
+// range are covered, so neighbouring weeks are never affected. No-op for in-memory packs.
+void Catalog::adviseWeek(const Pack::WeekRecord &week, int advice) const
+{
+    if (!mapped) return;
+    const uintptr_t page = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    auto advise = [&](size_t begin, size_t end) {
+        uintptr_t first = (reinterpret_cast<uintptr_t>(base) + begin + page - 1) & ~(page - 1);
+        uintptr_t last = (reinterpret_cast<uintptr_t>(base) + end) & ~(page - 1);
+        if (first < last) madvise(reinterpret_cast<void *>(first), last - first, advice);
+    };
+    advise(header.textOffset + static_cast<size_t>(week.textBegin), header.textOffset + static_cast<size_t>(week.textEnd));
+    advise(header.codeOffset + week.codeBegin * sizeof(Script::Instr),
+           header.codeOffset + week.codeEnd * sizeof(Script::Instr));
+}
+
+// Catalog::loadWeek()
+// Builds Scenario objects for one week only. Choice callbacks capture a pointer to this
+// catalog's image, which lives as long as the catalog.
+// Input: week number. Output: the week's scenarios.
+std::pmr::vector<Scenario> Catalog::loadWeek(int week) const
+{
+    PROFILE_SCOPE(LoadWeek);
+    std::pmr::vector<Scenario> list(sessionMemory());
+    const Pack::WeekRecord *wr = findWeek(week);
+    if (!wr) return list;
+    adviseWeek(*wr, MADV_WILLNEED);
+
+    list.reserve(wr->scenarioCount);
+    for (uint32_t s = wr->firstScenario; s < wr->firstScenario + wr->scenarioCount; ++s) {
+        const Pack::ScenarioRecord &sr = scenarioRecords[s];
+        Scenario sc;
+        sc.week = sr.week;
+        sc.index = sr.index;
+        sc.location = image.string(sr.location);
+        sc.prompt = image.string(sr.prompt);
+        sc.choices.reserve(sr.choiceCount);
+
+        for (uint32_t c = sr.firstChoice; c < sr.firstChoice + sr.choiceCount; ++c) {
+            const Pack::ChoiceRecord &cr = choiceRecords[c];
+            Choice choice(image.string(cr.title), image.string(cr.detail),
+                          Effect(cr.energy, cr.health, cr.social, cr.academic, cr.fitness, cr.money));
+            choice.lockReason = image.string(cr.lockReason);
+            for (uint32_t a = cr.firstAffinity; a < cr.firstAffinity + cr.affinityCount; ++a) {
+                const Pack::AffinityRecord &ar = affinityRecords[a];
+                choice.effect.affinityDeltas[image.string(ar.npc)] = ar.delta;
+            }
+            choice.image = &image;
+            if (cr.whenPc != Pack::kNone) {
+                choice.when.pc = static_cast<int>(cr.whenPc);
+                choice.when.locals = static_cast<int>(cr.whenLocals);
+            }
+            if (cr.scriptPc != Pack::kNone) {
+                choice.script.pc = static_cast<int>(cr.scriptPc);
+                choice.script.locals = static_cast<int>(cr.scriptLocals);
+            }
+            sc.choices.push_back(std::move(choice));
+        }
+        list.push_back(std::move(sc));
+    }
+    return list;
+}
+
+// Catalog::runEvent()
+// Looks the event up by name; the table is small and events fire a few times per week.
+// Input: event name and the game objects. Output: true if the event exists and was run.
+Task<bool> Catalog::runEvent(std::string_view name, GameState &state, Player &player, Relationships &rels) const
+{
+    PROFILE_SCOPE(EventRoll);
+    TRACE_SPAN("event", nullptr, 0, name);
+    for (size_t i = 0; i < image.eventCount; ++i) {
+        const Script::EventRef &ev = image.events[i];
+        if (image.string(ev.name) != name) continue;
+        Script::Entry entry;
+        entry.pc = ev.pc;
+        entry.locals = ev.locals;
+        Player before = player;
+        co_await Script::run(image, entry, state, player, rels);
+        if (GameObserver *observer = gameObserver()) observer->eventRan(state.currentWeek, name, before, player);
+        co_return true;
+    }
+    co_return false;
+}
+
+// Catalog::releaseWeek()
+// Drops the week's pages from this process. Text shared with later weeks is stored with the
+// week that first uses it, so a later week may fault a few of those pages back in from the
+// file; correctness never depends on what is resident.
+// Input: week number. Output: none.
+void Catalog::releaseWeek(int week) const
+{
+    const Pack::WeekRecord *wr = findWeek(week);
+    if (wr) adviseWeek(*wr, MADV_DONTNEED);
+}
+
+// Content::load()
+// Uses the pack only when it is strictly newer than the text file, so a stale pack never hides
+// edits to it. On a tie (a file system with coarse timestamps) the text is compiled again.
+// Input: text and pack paths, and error string. Output: catalog, or null with an error message.
+std::shared_ptr<const Catalog> load(const std::string &textPath, const std::string &packPath, std::string &error)
+{
+    struct stat textStat;
+    struct stat packStat;
+    bool haveText = stat(textPath.c_str(), &textStat) == 0;
+    bool havePack = stat(packPath.c_str(), &packStat) == 0;
+
+    if (havePack && (!haveText || newerThan(packStat, textStat))) {
+        std::shared_ptr<const Catalog> catalog = Catalog::openPack(packPath, error);
+        if (catalog || !haveText) return catalog;
+    }
+
+    std::vector<char> bytes;
+    if (!compileFile(textPath, bytes, error)) return nullptr;
+    return Catalog::fromPack(std::move(bytes), error);
+}
+
+// LiveCatalog::LiveCatalog()
+// Remembers the content paths; nothing is loaded until load() is called.
+LiveCatalog::LiveCatalog(const std::string &textPath_, const std::string &packPath_)
+    : textPath(textPath_), packPath(packPath_)
+{
+}
+
+LiveCatalog::~LiveCatalog()
+{
+    if (watchFd >= 0) close(watchFd);
+}
+
+// LiveCatalog::load()
+// Builds the new catalog completely before publishing it, so readers never see a partial one.
+// Input: error string. Output: true if a catalog was published.
+bool LiveCatalog::load(std::string &error)
+{
+    std::shared_ptr<const Catalog> next = Content::load(textPath, packPath, error);
+    if (!next) return false;
+    std::atomic_store(&active, next);
+    return true;
+}
+
+// LiveCatalog::current()
+// Takes a counted reference to the published catalog.
+std::shared_ptr<const Catalog> LiveCatalog::current() const
+{
+    return std::atomic_load(&active);
+}
+
+// LiveCatalog::watch()
+// Watches the directory rather than the files: packc and most editors replace a file by renaming
+// a new one over it, which a watch on the old file would miss.
+// Input: none. Output: readable-on-change descriptor, or -1.
+int LiveCatalog::watch()
+{
+    if (watchFd >= 0) return watchFd;
+    std::string dir;
+    std::string name;
+    splitPath(textPath, dir, name);
+    watchFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (watchFd < 0) return -1;
+    if (inotify_add_watch(watchFd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        close(watchFd);
+        watchFd = -1;
+    }
+    return watchFd;
+}
+
+// LiveCatalog::refresh()
+// Reads every queued notification, then reloads at most once.
+// Input: error string. Output: true if a new catalog was published.
+bool LiveCatalog::refresh(std::string &error)
+{
+    if (watchFd < 0) return false;
+    std::string dir;
+    std::string textName;
+    std::string packName;
+    splitPath(textPath, dir, textName);
+    splitPath(packPath, dir, packName);
+
+    bool changed = false;
+    alignas(inotify_event) char buffer[sizeof(inotify_event) + NAME_MAX + 1];
+    ssize_t n;
+    while ((n = read(watchFd, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t at = 0; at < n;) {
+            const inotify_event *ev = reinterpret_cast<const inotify_event *>(buffer + at);
+            if (ev->len > 0 && (textName == ev->name || packName == ev->name)) changed = true;
+            at += static_cast<ssize_t>(sizeof(inotify_event) + ev->len);
+        }
+    }
+    return changed && load(error);
+}
+
+} // namespace Content
@@ -0,0 +1,127 @@
+#ifndef CATALOG_H
+#define CATALOG_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "pack.h"
+#include "scenario.h"
+#include "script.h"
+
+namespace Content {
+
+// Catalog
+// Immutable set of scenarios backed by one content pack. The pack is either memory-mapped
+// read-only from disk (so every game process on a host shares the same pages) or held in memory
+// after compiling scenarios.txt. Scenarios are built one week at a time: their text fields are
+// string_views into the pack and their scripts run directly from its bytecode. Keep the Catalog
+// alive for as long as any of its scenarios are in use.
+class Catalog {
+public:
+    ~Catalog();
+    Catalog(const Catalog &) = delete;
+    Catalog &operator=(const Catalog &) = delete;
+
+    // openPack()
+    // Memory-maps a pack file and validates it.
+    // Input: pack path and a string for the error message. Output: catalog, or null on error.
+    static std::shared_ptr<const Catalog> openPack(const std::string &path, std::string &error);
+
+    // fromPack()
+    // Validates pack bytes that are already in memory and builds a catalog over them.
+    // Input: pack bytes (taken over by the catalog) and error string. Output: catalog, or null on error.
+    static std::shared_ptr<const Catalog> fromPack(std::vector<char> bytes, std::string &error);
+
+    // loadWeek()
+    // Builds the scenarios for one week and asks the OS to page in that week's text and bytecode.
+    // Input: week number. Output: the week's scenarios in file order (empty if the week has none).
+    std::pmr::vector<Scenario> loadWeek(int week) const;
+
+    // releaseWeek()
+    // Tells the OS that a finished week's text and bytecode pages are no longer needed, so they
+    // stop counting toward this process's resident memory. Safe to call for any week: released
+    // pages are simply read back from the file if they are touched again.
+    // Input: week number. Output: none.
+    void releaseWeek(int week) const;
+
+    // runEvent()
+    // Runs a named event script from the content file (e.g. "weekEndRandomEvents"). Events may ask
+    // the player something, so co_await the result.
+    // Input: event name and the game objects to update. Output: false if the content defines no such event.
+    Task<bool> runEvent(std::string_view name, GameState &state, Player &player, Relationships &rels) const;
+
+private:
+    Catalog() = default;
+
+    // bind()
+    // Validates the pack at data/size and points the image and record tables into it.
+    bool bind(const char *data, size_t size, std::string &error);
+
+    const Pack::WeekRecord *findWeek(int week) const;
+    void adviseWeek(const Pack::WeekRecord &week, int advice) const;
+
+    void *mapped = nullptr;
+    size_t mappedSize = 0;
+    std::vector<char> owned;
+    const char *base = nullptr;
+    Pack::Header header{};
+    const Pack::WeekRecord *weeks = nullptr;
+    const Pack::ScenarioRecord *scenarioRecords = nullptr;
+    const Pack::ChoiceRecord *choiceRecords = nullptr;
+    const Pack::AffinityRecord *affinityRecords = nullptr;
+    Script::Image image;
+};
+
+// LiveCatalog
+// Holds the current catalog for a long-running process and swaps in a new one when the content
+// files change, RCU style: a session calls current() once when it starts and keeps that pointer
+// until it ends, so it always finishes on the version it started with. Publishing a new catalog
+// is a single atomic pointer store; an old catalog is freed when the last session using it drops
+// its reference.
+class LiveCatalog {
+public:
+    LiveCatalog(const std::string &textPath, const std::string &packPath);
+    ~LiveCatalog();
+    LiveCatalog(const LiveCatalog &) = delete;
+    LiveCatalog &operator=(const LiveCatalog &) = delete;
+
+    // load()
+    // Loads the content and publishes it, replacing any current catalog.
+    // Input: string for the error message. Output: false if the content could not be loaded.
+    bool load(std::string &error);
+
+    // current()
+    // Returns the most recently published catalog. Safe to call from any thread.
+    std::shared_ptr<const Catalog> current() const;
+
+    // watch()
+    // Starts watching the content directory for edits to the text or pack file.
+    // Input: none. Output: file descriptor that becomes readable when something changed (for poll/epoll),
+    // or -1 if watching is not available.
+    int watch();
+
+    // refresh()
+    // Drains pending change notifications and, if a content file changed, reloads and publishes it.
+    // A broken edit leaves the current catalog in place so running and new sessions are unaffected.
+    // Input: string for the error message. Output: true if a new catalog was published.
+    bool refresh(std::string &error);
+
+private:
+    std::string textPath;
+    std::string packPath;
+    std::shared_ptr<const Catalog> active; // read and written with std::atomic_load/atomic_store
+    int watchFd = -1;
+};
+
+// load()
+// Loads the game content, preferring the compiled pack when it is at least as new as the text.
+// Falls back to compiling the text in memory when the pack is missing, stale, or unreadable,
+// so writers can edit scenarios.txt without rebuilding.
+// Input: text and pack paths, and a string for the error message. Output: catalog, or null on error.
+std::shared_ptr<const Catalog> load(const std::string &textPath, const std::string &packPath, std::string &error);
+
+} // namespace Content
+
+#endif // CATALOG_H
@@ -0,0 +1,213 @@
+#include "columns.h"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace Columns {
+
+namespace {
+
+// Column
+// One column: its table, name, width in bytes, and whether it is signed.
+struct Column {
+    const char *table;
+    const char *name;
+    int width;
+    bool isSigned;
+};
+
+// Columns in file order; the enum below indexes this list.
+const Column kColumns[] = {
+    {"games", "seed", 4, false},
+    {"games", "ended", 1, false},
+    {"games", "game_over", 1, false},
+    {"games", "week", 1, false},
+    {"games", "stars", 1, false},
+    {"games", "cause", 1, false},
+    {"games", "hospital_visits", 2, false},
+    {"games", "collapses", 2, false},
+    {"games", "energy", 4, true},
+    {"games", "health", 4, true},
+    {"games", "social", 4, true},
+    {"games", "academic", 4, true},
+    {"games", "fitness", 4, true},
+    {"games", "money", 4, true},
+    {"weeks", "reached", 1, false},
+    {"weeks", "energy", 4, true},
+    {"weeks", "health", 4, true},
+    {"weeks", "social", 4, true},
+    {"weeks", "academic", 4, true},
+    {"weeks", "fitness", 4, true},
+    {"weeks", "money", 4, true},
+};
+
+enum ColumnIndex {
+    Seed,
+    Ended,
+    GameOver,
+    Week,
+    Stars,
+    Cause,
+    HospitalVisits,
+    Collapses,
+    FinalStats, // six columns, energy to money
+    Reached = FinalStats + 6,
+    WeekStats, // six columns, energy to money
+    kColumnCount = WeekStats + 6
+};
+
+static_assert(sizeof(kColumns) / sizeof(kColumns[0]) == kColumnCount, "column list and ColumnIndex disagree");
+
+// rowsPerGame()
+// Returns how many rows one game takes in a table.
+size_t rowsPerGame(const char *table)
+{
+    return std::strcmp(table, "weeks") == 0 ? static_cast<size_t>(kSummerWeeks) : 1;
+}
+
+// fileName()
+// Returns a column's path inside the export directory, e.g. "games/stars.u1".
+std::string fileName(const Column &column)
+{
+    return std::string(column.table) + "/" + column.name + (column.isSigned ? ".i" : ".u") +
+           std::to_string(column.width);
+}
+
+// dtype()
+// Returns a column's numpy dtype string, e.g. "<i4".
+std::string dtype(const Column &column)
+{
+    const char *order = column.width == 1 ? "|" : std::endian::native == std::endian::little ? "<" : ">";
+    return std::string(order) + (column.isSigned ? "i" : "u") + std::to_string(column.width);
+}
+
+// stats()
+// Returns the six stats in column order.
+void stats(const Player &p, int32_t (&values)[6])
+{
+    values[0] = p.energy;
+    values[1] = p.health;
+    values[2] = p.social;
+    values[3] = p.academic;
+    values[4] = p.fitness;
+    values[5] = p.money;
+}
+
+} // anonymous namespace
+
+// Writer::open()
+// Files are created at full size and left sparse, so rows never written read as zeros.
+bool Writer::open(const std::string &dir, int count, std::string &error)
+{
+    close();
+    for (const Column &column : kColumns) {
+        std::string table = dir + "/" + column.table;
+        std::error_code failed;
+        std::filesystem::create_directories(table, failed);
+        if (failed) {
+            error = table + ": could not create directory";
+            return false;
+        }
+    }
+    directory = dir;
+    games = count;
+    for (const Column &column : kColumns) {
+        std::string path = dir + "/" + fileName(column);
+        Mapping mapping;
+        mapping.bytes = static_cast<size_t>(count) * rowsPerGame(column.table) * static_cast<size_t>(column.width);
+        int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0 || ftruncate(fd, static_cast<off_t>(mapping.bytes)) != 0) {
+            if (fd >= 0) ::close(fd);
+            error = path + ": could not create column file";
+            close();
+            return false;
+        }
+        if (mapping.bytes > 0) {
+            mapping.data = mmap(nullptr, mapping.bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            if (mapping.data == MAP_FAILED) {
+                ::close(fd);
+                error = path + ": could not map column file";
+                close();
+                return false;
+            }
+        }
+        ::close(fd);
+        columns.push_back(mapping);
+    }
+    return true;
+}
+
+// Writer::add()
+// Each value is narrowed to its column's width.
+void Writer::add(int game, const Session &session)
+{
+    if (game < 0 || game >= games || columns.size() != kColumnCount) return;
+    auto put = [this](int column, size_t row, int64_t value) {
+        int width = kColumns[column].width;
+        unsigned char *cell = static_cast<unsigned char *>(columns[static_cast<size_t>(column)].data) + row * width;
+        if (width == 1) {
+            uint8_t narrow = static_cast<uint8_t>(value);
+            std::memcpy(cell, &narrow, 1);
+        } else if (width == 2) {
+            uint16_t narrow = static_cast<uint16_t>(value);
+            std::memcpy(cell, &narrow, 2);
+        } else {
+            uint32_t narrow = static_cast<uint32_t>(value);
+            std::memcpy(cell, &narrow, 4);
+        }
+    };
+    size_t row = static_cast<size_t>(game);
+    int32_t values[6];
+    put(Seed, row, session.gameSeed());
+    if (const Outcome *outcome = session.outcome()) {
+        put(Ended, row, 1);
+        put(GameOver, row, outcome->gameOver ? 1 : 0);
+        put(Week, row, outcome->week);
+        put(Stars, row, outcome->stars);
+        put(Cause, row, static_cast<int>(outcome->cause));
+        put(HospitalVisits, row, outcome->hospitalVisits);
+        put(Collapses, row, outcome->collapses);
+        stats(outcome->player, values);
+        for (int i = 0; i < 6; ++i) put(FinalStats + i, row, values[i]);
+    }
+    for (int week = 1; week <= kSummerWeeks; ++week) {
+        const Player *player = session.weekStats(week);
+        if (!player) continue;
+        size_t weekRow = row * kSummerWeeks + static_cast<size_t>(week - 1);
+        put(Reached, weekRow, 1);
+        stats(*player, values);
+        for (int i = 0; i < 6; ++i) put(WeekStats + i, weekRow, values[i]);
+    }
+}
+
+// Writer::close()
+// schema.txt has one line per column: file, dtype, rows.
+bool Writer::close()
+{
+    if (directory.empty()) return true;
+    bool complete = columns.size() == kColumnCount;
+    for (Mapping &mapping : columns) {
+        if (mapping.data) munmap(mapping.data, mapping.bytes);
+    }
+    columns.clear();
+    bool written = true;
+    if (complete) {
+        std::ofstream schema(directory + "/schema.txt");
+        schema << "# file dtype rows\n";
+        for (const Column &column : kColumns) {
+            schema << fileName(column) << " " << dtype(column) << " "
+                   << static_cast<size_t>(games) * rowsPerGame(column.table) << "\n";
+        }
+        written = static_cast<bool>(schema.flush());
+    }
+    directory.clear();
+    games = 0;
+    return written;
+}
+
+} // namespace Columns
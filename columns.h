@@ -0,0 +1,66 @@
+#ifndef COLUMNS_H
+#define COLUMNS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "session.h"
+
+// Columnar export of batch results (`--simulate GAMES --columns DIR`), for analysis tools that
+// scan millions of games without parsing text. Every column is its own file of fixed-width
+// native-endian integers with one value per row, so it loads directly, e.g. with
+// numpy.fromfile(path, dtype). DIR/schema.txt lists each file with its dtype and row count.
+//
+//   games/   one row per game, in game order: seed, ended (1 if it reached its ending),
+//            game_over, week, stars, cause (GameOverCause), hospital_visits, collapses, and the
+//            six final stats. Games that never ended have zeros after seed.
+//   weeks/   one row per game and week (row = game * kSummerWeeks + week - 1): reached (1 if the
+//            game finished that week) and the six stats at the end of the week, or zeros.
+//
+// The files are sized for the whole run up front and mapped into memory, so workers fill their
+// games' rows in place without locking.
+namespace Columns {
+
+// Writer
+// The column files of one batch run.
+class Writer {
+public:
+    Writer() = default;
+    ~Writer() { close(); }
+
+    Writer(const Writer &) = delete;
+    Writer &operator=(const Writer &) = delete;
+
+    // open()
+    // Creates DIR (if needed) and its column files, sized for the given number of games.
+    // Input: directory, game count, and a string for the error message. Output: true on success.
+    bool open(const std::string &dir, int games, std::string &error);
+
+    // add()
+    // Fills one game's rows from its finished session. Different games may be added at once from
+    // different threads.
+    // Input: game index (0 to games - 1) and session. Output: none.
+    void add(int game, const Session &session);
+
+    // close()
+    // Unmaps the files and writes schema.txt. Later calls do nothing.
+    // Input: none. Output: false if schema.txt could not be written.
+    bool close();
+
+private:
+    // Mapping
+    // One column file mapped into memory.
+    struct Mapping {
+        void *data = nullptr;
+        size_t bytes = 0;
+    };
+
+    std::string directory;
+    int games = 0;
+    std::vector<Mapping> columns; // in the order of the column list in columns.cpp
+};
+
+} // namespace Columns
+
+#endif // COLUMNS_H
@@ -0,0 +1,300 @@
+#include "content.h"
+#include "pack.h"
+#include "script.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace {
+
+// Reads a signed integer such as "-25", "+8" or "3".
+bool readInt(Script::Lexer &lex, int32_t &out)
+{
+    bool negative = false;
+    if (lex.accept("-")) negative = true;
+    else lex.accept("+");
+    if (lex.peek().kind != Script::Tok::Number) {
+        lex.fail("expected a number");
+        return false;
+    }
+    int value = static_cast<int>(lex.next().number);
+    out = negative ? -value : value;
+    return true;
+}
+
+bool readString(Script::Lexer &lex, std::string &out)
+{
+    if (lex.peek().kind != Script::Tok::String) {
+        lex.fail("expected a string");
+        return false;
+    }
+    out = lex.next().text;
+    return true;
+}
+
+// Source-side records collected while parsing, before they are laid out as a pack.
+struct ChoiceSource {
+    Pack::ChoiceRecord record{};
+    std::vector<Pack::AffinityRecord> affinities;
+};
+
+struct ScenarioSource {
+    Pack::ScenarioRecord record{};
+    std::vector<ChoiceSource> choices;
+};
+
+// Parses "effect <stat> <delta> ... affinity \"npc\" <delta>" into the choice's base effect.
+void readEffect(Script::Lexer &lex, Script::Program &program, ChoiceSource &choice)
+{
+    Pack::ChoiceRecord &effect = choice.record;
+    while (!lex.failed() && lex.peek().kind == Script::Tok::Ident) {
+        const std::string word = lex.peek().text;
+        int32_t *field = nullptr;
+        if (word == "energy") field = &effect.energy;
+        else if (word == "health") field = &effect.health;
+        else if (word == "social") field = &effect.social;
+        else if (word == "academic") field = &effect.academic;
+        else if (word == "fitness") field = &effect.fitness;
+        else if (word == "money") field = &effect.money;
+
+        if (field) {
+            lex.next();
+            readInt(lex, *field);
+        } else if (word == "affinity") {
+            lex.next();
+            std::string npc;
+            int delta = 0;
+            if (readString(lex, npc) && readInt(lex, delta)) {
+                uint32_t id = static_cast<uint32_t>(program.addString(npc));
+                bool replaced = false;
+                for (auto &entry : choice.affinities) {
+                    if (entry.npc == id) {
+                        entry.delta = delta;
+                        replaced = true;
+                    }
+                }
+                if (!replaced) choice.affinities.push_back({id, delta});
+            }
+        } else {
+            break;
+        }
+    }
+}
+
+// Reads a string and interns it, storing the string-table index.
+bool readStringId(Script::Lexer &lex, Script::Program &program, uint32_t &out)
+{
+    std::string text;
+    if (!readString(lex, text)) return false;
+    out = static_cast<uint32_t>(program.addString(text));
+    return true;
+}
+
+// Appends one record array at the next 8-byte boundary and fills in its header fields.
+template <typename T>
+void appendSection(std::vector<char> &out, const T *items, size_t count, uint32_t &countField,
+                   uint32_t &offsetField)
+{
+    out.resize((out.size() + 7) & ~static_cast<size_t>(7), 0);
+    countField = static_cast<uint32_t>(count);
+    offsetField = static_cast<uint32_t>(out.size());
+    const char *bytes = reinterpret_cast<const char *>(items);
+    out.insert(out.end(), bytes, bytes + count * sizeof(T));
+}
+
+// Returns the instruction range [begin, end) of the script starting at pc. Scripts are compiled
+// back to back, so each one ends where the next entry point (or the bytecode) begins.
+std::pair<uint32_t, uint32_t> scriptExtent(uint32_t pc, const std::vector<uint32_t> &entries, size_t codeSize)
+{
+    auto next = std::upper_bound(entries.begin(), entries.end(), pc);
+    return {pc, next == entries.end() ? static_cast<uint32_t>(codeSize) : *next};
+}
+
+// Lays out the parsed scenarios, bytecode, and string table in pack format. Scenarios are grouped
+// by week, and strings are placed in the order weeks first use them so each week's text is one
+// contiguous range.
+void writePack(std::vector<ScenarioSource> scenarios, const Script::Program &program, std::vector<char> &out)
+{
+    std::stable_sort(scenarios.begin(), scenarios.end(), [](const ScenarioSource &x, const ScenarioSource &y) {
+        return x.record.week < y.record.week;
+    });
+
+    std::vector<uint32_t> entries;
+    for (const auto &ev : program.events) entries.push_back(static_cast<uint32_t>(ev.pc));
+    for (const auto &sc : scenarios) {
+        for (const auto &choice : sc.choices) {
+            if (choice.record.scriptPc != Pack::kNone) entries.push_back(choice.record.scriptPc);
+            if (choice.record.whenPc != Pack::kNone) entries.push_back(choice.record.whenPc);
+        }
+    }
+    std::sort(entries.begin(), entries.end());
+
+    std::vector<Script::StringRef> stringRefs(program.strings.size(), Script::StringRef{0, 0});
+    std::vector<bool> placed(program.strings.size(), false);
+    std::string text;
+    auto place = [&](uint32_t id) {
+        if (placed[id]) return;
+        placed[id] = true;
+        stringRefs[id] = {static_cast<uint32_t>(text.size()), static_cast<uint32_t>(program.strings[id].size())};
+        text += program.strings[id];
+    };
+
+    std::vector<Pack::WeekRecord> weekRecords;
+    std::vector<Pack::ScenarioRecord> scenarioRecords;
+    std::vector<Pack::ChoiceRecord> choiceRecords;
+    std::vector<Pack::AffinityRecord> affinityRecords;
+    for (const auto &sc : scenarios) {
+        if (weekRecords.empty() || weekRecords.back().week != sc.record.week) {
+            Pack::WeekRecord week{};
+            week.week = sc.record.week;
+            week.firstScenario = static_cast<uint32_t>(scenarioRecords.size());
+            week.textBegin = week.textEnd = static_cast<uint32_t>(text.size());
+            week.codeBegin = static_cast<uint32_t>(program.code.size());
+            weekRecords.push_back(week);
+        }
+        Pack::WeekRecord &week = weekRecords.back();
+        ++week.scenarioCount;
+
+        Pack::ScenarioRecord record = sc.record;
+        record.firstChoice = static_cast<uint32_t>(choiceRecords.size());
+        record.choiceCount = static_cast<uint32_t>(sc.choices.size());
+        scenarioRecords.push_back(record);
+        place(record.location);
+        place(record.prompt);
+
+        for (const auto &choice : sc.choices) {
+            Pack::ChoiceRecord c = choice.record;
+            c.firstAffinity = static_cast<uint32_t>(affinityRecords.size());
+            c.affinityCount = static_cast<uint32_t>(choice.affinities.size());
+            choiceRecords.push_back(c);
+            affinityRecords.insert(affinityRecords.end(), choice.affinities.begin(), choice.affinities.end());
+            place(c.title);
+            place(c.detail);
+            place(c.lockReason);
+            for (const auto &entry : choice.affinities) place(entry.npc);
+
+            for (uint32_t pc : {c.whenPc, c.scriptPc}) {
+                if (pc == Pack::kNone) continue;
+                std::pair<uint32_t, uint32_t> extent = scriptExtent(pc, entries, program.code.size());
+                for (uint32_t i = extent.first; i < extent.second; ++i) {
+                    if (program.code[i].op == Script::Op::PushStr) place(static_cast<uint32_t>(program.code[i].a));
+                }
+                week.codeBegin = std::min(week.codeBegin, extent.first);
+                week.codeEnd = std::max(week.codeEnd, extent.second);
+            }
+        }
+        week.textEnd = static_cast<uint32_t>(text.size());
+    }
+    for (uint32_t id = 0; id < placed.size(); ++id) place(id);
+    for (auto &week : weekRecords) {
+        if (week.codeEnd == 0) week.codeBegin = 0; // week without scripts
+    }
+
+    Pack::Header header{};
+    std::memcpy(header.magic, Pack::kMagic, sizeof(header.magic));
+    header.version = Pack::kVersion;
+    header.instrSize = sizeof(Script::Instr);
+
+    out.assign(sizeof(header), 0);
+    appendSection(out, weekRecords.data(), weekRecords.size(), header.weekCount, header.weekOffset);
+    appendSection(out, scenarioRecords.data(), scenarioRecords.size(), header.scenarioCount, header.scenarioOffset);
+    appendSection(out, choiceRecords.data(), choiceRecords.size(), header.choiceCount, header.choiceOffset);
+    appendSection(out, affinityRecords.data(), affinityRecords.size(), header.affinityCount, header.affinityOffset);
+    appendSection(out, program.code.data(), program.code.size(), header.codeCount, header.codeOffset);
+    appendSection(out, program.events.data(), program.events.size(), header.eventCount, header.eventOffset);
+    appendSection(out, stringRefs.data(), stringRefs.size(), header.stringCount, header.stringOffset);
+    appendSection(out, text.data(), text.size(), header.textSize, header.textOffset);
+    std::memcpy(out.data(), &header, sizeof(header));
+}
+
+} // anonymous namespace
+
+// Content::compile()
+// Parses the content text top to bottom. "event" defines a named event script, "scenario" opens
+// a new scenario, "choice" adds a choice to it, and the remaining keywords fill in the most recent
+// scenario or choice.
+// Scripts and conditions are compiled into one shared program, then everything is written out
+// as a pack.
+// Input: source text, output buffer, and error string. Output: true when every entry parsed.
+bool Content::compile(const std::string &source, std::vector<char> &pack, std::string &error)
+{
+    Script::Program program;
+    Script::Lexer lex(source);
+    Script::Compiler compiler(program, lex);
+    std::vector<ScenarioSource> scenarios;
+
+    while (!lex.failed() && lex.peek().kind != Script::Tok::End) {
+        ScenarioSource *sc = scenarios.empty() ? nullptr : &scenarios.back();
+        ChoiceSource *choice = (sc && !sc->choices.empty()) ? &sc->choices.back() : nullptr;
+
+        if (lex.accept("event")) {
+            Script::Token name = lex.next();
+            if (name.kind != Script::Tok::Ident) lex.fail("expected an event name");
+            else compiler.compileEvent(name.text);
+        } else if (lex.accept("scenario")) {
+            ScenarioSource next;
+            if (readInt(lex, next.record.week) && readInt(lex, next.record.index) &&
+                readStringId(lex, program, next.record.location)) {
+                next.record.prompt = static_cast<uint32_t>(program.addString(""));
+                scenarios.push_back(next);
+            }
+        } else if (!sc) {
+            lex.fail("expected 'scenario'");
+        } else if (lex.accept("prompt")) {
+            readStringId(lex, program, sc->record.prompt);
+        } else if (lex.accept("choice")) {
+            ChoiceSource next;
+            uint32_t empty = static_cast<uint32_t>(program.addString(""));
+            next.record.detail = empty;
+            next.record.lockReason = empty;
+            next.record.scriptPc = Pack::kNone;
+            next.record.whenPc = Pack::kNone;
+            if (readStringId(lex, program, next.record.title)) sc->choices.push_back(next);
+        } else if (!choice) {
+            lex.fail("expected 'prompt' or 'choice'");
+        } else if (lex.accept("detail")) {
+            readStringId(lex, program, choice->record.detail);
+        } else if (lex.accept("effect")) {
+            readEffect(lex, program, *choice);
+        } else if (lex.accept("locked")) {
+            readStringId(lex, program, choice->record.lockReason);
+        } else if (lex.accept("when")) {
+            Script::Entry entry = compiler.compileCondition();
+            choice->record.whenPc = static_cast<uint32_t>(entry.pc);
+            choice->record.whenLocals = static_cast<uint32_t>(entry.locals);
+        } else if (lex.accept("script")) {
+            Script::Entry entry = compiler.compileBlock();
+            choice->record.scriptPc = static_cast<uint32_t>(entry.pc);
+            choice->record.scriptLocals = static_cast<uint32_t>(entry.locals);
+        } else {
+            lex.fail("unknown keyword");
+        }
+    }
+
+    if (!compiler.finish()) {
+        error = lex.errorMessage();
+        return false;
+    }
+    writePack(std::move(scenarios), program, pack);
+    return true;
+}
+
+// Content::compileFile()
+// Reads a content file and compiles it.
+// Input: file path, output buffer, and error string. Output: true on success; errors are prefixed with the path.
+bool Content::compileFile(const std::string &path, std::vector<char> &pack, std::string &error)
+{
+    std::ifstream ifs(path);
+    if (!ifs) {
+        error = path + ": could not open content file";
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+    if (!compile(buffer.str(), pack, error)) {
+        error = path + ": " + error;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,24 @@
+#ifndef CONTENT_H
+#define CONTENT_H
+
+#include <string>
+#include <vector>
+
+// Content compiler: turns the scenario text format (scenarios.txt) into a binary content pack
+// (see pack.h). The game loads packs through Content::Catalog (catalog.h).
+namespace Content {
+    // compile()
+    // Parses scenario content text and compiles every choice script and availability condition,
+    // producing the bytes of a content pack.
+    // Input: content text, buffer to fill, and a string for the error message.
+    // Output: true on success; false with a "line N: ..." message if the content is invalid.
+    bool compile(const std::string &source, std::vector<char> &pack, std::string &error);
+
+    // compileFile()
+    // Same as compile(), reading the content text from a file.
+    // Input: path to the content file, buffer to fill, and a string for the error message.
+    // Output: true on success; false with a "path: line N: ..." message if the file is missing or invalid.
+    bool compileFile(const std::string &path, std::vector<char> &pack, std::string &error);
+}
+
+#endif // CONTENT_H
@@ -0,0 +1,274 @@
+#include "eventlog.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <signal.h>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace EventLog {
+
+namespace {
+
+const size_t kChunkSize = 64 * 1024;
+const size_t kMaxRecord = 512; // longest record: a Name with a 255-byte name, with room to spare
+
+// Chunk
+// A run of whole records from one thread.
+struct Chunk {
+    unsigned char bytes[kChunkSize];
+    size_t used = 0;
+};
+
+// Writer
+// The open file and the thread that writes full chunks to it. Written chunks go on a free list
+// for the logging threads to reuse.
+struct Writer {
+    std::mutex lock;
+    std::condition_variable ready;
+    std::deque<std::unique_ptr<Chunk>> full;
+    std::vector<std::unique_ptr<Chunk>> spare;
+    FILE *file = nullptr;
+    std::thread thread;
+    bool stopping = false;
+    std::atomic<bool> open{false};
+    std::atomic<uint32_t> games{0};
+    std::atomic<uint64_t> generation{0}; // bumped by each start(), so buffers from an earlier log are dropped
+
+    ~Writer() { stop(); }
+
+    // run()
+    // Writes chunks as they arrive until stopped and drained. Signals are blocked on this thread,
+    // so a stop signal reaches the thread that handles it (e.g. the server's) rather than killing
+    // the process here.
+    void run()
+    {
+        sigset_t all;
+        sigfillset(&all);
+        pthread_sigmask(SIG_BLOCK, &all, nullptr);
+        std::unique_lock<std::mutex> guard(lock);
+        for (;;) {
+            ready.wait(guard, [this]() { return stopping || !full.empty(); });
+            if (full.empty()) return;
+            std::unique_ptr<Chunk> chunk = std::move(full.front());
+            full.pop_front();
+            guard.unlock();
+            std::fwrite(chunk->bytes, 1, chunk->used, file);
+            chunk->used = 0;
+            guard.lock();
+            spare.push_back(std::move(chunk));
+        }
+    }
+
+    // hand()
+    // Queues a chunk for writing and returns an empty one.
+    std::unique_ptr<Chunk> hand(std::unique_ptr<Chunk> chunk)
+    {
+        std::unique_ptr<Chunk> fresh;
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            if (chunk && chunk->used) full.push_back(std::move(chunk));
+            if (!spare.empty()) {
+                fresh = std::move(spare.back());
+                spare.pop_back();
+            }
+        }
+        ready.notify_one();
+        return fresh ? std::move(fresh) : std::make_unique<Chunk>();
+    }
+};
+
+Writer writer;
+
+// Buffer
+// One thread's current chunk and the event names it has already defined in the log.
+struct Buffer {
+    std::unique_ptr<Chunk> chunk;
+    std::unordered_set<uint32_t> names;
+    uint64_t generation = 0;
+
+    ~Buffer()
+    {
+        if (chunk && chunk->used && writer.open && generation == writer.generation) writer.hand(std::move(chunk));
+    }
+
+    // reserve()
+    // Returns the chunk with room for one more record, handing over a full one first.
+    Chunk &reserve()
+    {
+        uint64_t current = writer.generation.load();
+        if (generation != current) {
+            chunk.reset();
+            names.clear();
+            generation = current;
+        }
+        if (!chunk) chunk = writer.hand(nullptr);
+        if (chunk->used + kMaxRecord > kChunkSize) chunk = writer.hand(std::move(chunk));
+        return *chunk;
+    }
+};
+
+thread_local Buffer buffer;
+
+// put()
+// Appends an unsigned varint.
+void put(Chunk &chunk, uint64_t value)
+{
+    while (value >= 0x80) {
+        chunk.bytes[chunk.used++] = static_cast<unsigned char>(value | 0x80);
+        value >>= 7;
+    }
+    chunk.bytes[chunk.used++] = static_cast<unsigned char>(value);
+}
+
+// putSigned()
+// Appends a zigzag-encoded signed varint.
+void putSigned(Chunk &chunk, int64_t value)
+{
+    put(chunk, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+// putStats()
+// Appends the six stats, or their changes when before is given.
+void putStats(Chunk &chunk, const Player &p, const Player *before = nullptr)
+{
+    const Player zero(0, 0, 0, 0, 0, 0);
+    const Player &b = before ? *before : zero;
+    putSigned(chunk, p.energy - b.energy);
+    putSigned(chunk, p.health - b.health);
+    putSigned(chunk, p.social - b.social);
+    putSigned(chunk, p.academic - b.academic);
+    putSigned(chunk, p.fitness - b.fitness);
+    putSigned(chunk, p.money - b.money);
+}
+
+// nameId()
+// FNV-1a hash of an event name, used as its id.
+uint32_t nameId(std::string_view name)
+{
+    uint32_t hash = 2166136261u;
+    for (char c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+} // anonymous namespace
+
+// start()
+bool start(const std::string &path, std::string &error)
+{
+    stop();
+    FILE *file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::fwrite(kMagic, 1, sizeof(kMagic), file);
+    writer.file = file;
+    writer.stopping = false;
+    writer.generation++;
+    writer.open = true;
+    writer.thread = std::thread([]() { writer.run(); });
+    return true;
+}
+
+// stop()
+// The calling thread's chunk is handed over here; other threads' chunks were handed over when
+// they exited.
+void stop()
+{
+    if (!writer.open.exchange(false)) return;
+    if (buffer.chunk && buffer.generation == writer.generation) writer.hand(std::move(buffer.chunk));
+    {
+        std::lock_guard<std::mutex> guard(writer.lock);
+        writer.stopping = true;
+    }
+    writer.ready.notify_one();
+    writer.thread.join();
+    std::fclose(writer.file);
+    writer.file = nullptr;
+}
+
+// flush()
+void flush()
+{
+    if (!enabled() || !buffer.chunk || !buffer.chunk->used || buffer.generation != writer.generation) return;
+    buffer.chunk = writer.hand(std::move(buffer.chunk));
+}
+
+// enabled()
+bool enabled()
+{
+    return writer.open.load(std::memory_order_relaxed);
+}
+
+// newGame()
+uint32_t newGame(uint32_t seed)
+{
+    if (!enabled()) return 0;
+    uint32_t game = ++writer.games;
+    Chunk &chunk = buffer.reserve();
+    chunk.bytes[chunk.used++] = Start;
+    put(chunk, game);
+    put(chunk, seed);
+    return game;
+}
+
+// choice()
+void choice(uint32_t game, int week, int slot, int choice, int available, const Player &before, const Player &after)
+{
+    if (!enabled()) return;
+    Chunk &chunk = buffer.reserve();
+    chunk.bytes[chunk.used++] = Choice;
+    put(chunk, game);
+    put(chunk, static_cast<uint64_t>(week));
+    put(chunk, static_cast<uint64_t>(slot));
+    put(chunk, static_cast<uint64_t>(choice));
+    put(chunk, static_cast<uint64_t>(available));
+    putStats(chunk, after, &before);
+}
+
+// event()
+// Names longer than 255 bytes are cut short.
+void event(uint32_t game, int week, std::string_view name, const Player &before, const Player &after)
+{
+    if (!enabled()) return;
+    uint32_t id = nameId(name);
+    Chunk *chunk = &buffer.reserve();
+    if (buffer.names.insert(id).second) {
+        size_t length = std::min<size_t>(name.size(), 255);
+        chunk->bytes[chunk->used++] = Name;
+        put(*chunk, id);
+        put(*chunk, length);
+        for (size_t i = 0; i < length; ++i) chunk->bytes[chunk->used++] = static_cast<unsigned char>(name[i]);
+        chunk = &buffer.reserve();
+    }
+    chunk->bytes[chunk->used++] = Event;
+    put(*chunk, game);
+    put(*chunk, static_cast<uint64_t>(week));
+    put(*chunk, id);
+    putStats(*chunk, after, &before);
+}
+
+// end()
+void end(uint32_t game, const Outcome &outcome)
+{
+    if (!enabled()) return;
+    Chunk &chunk = buffer.reserve();
+    chunk.bytes[chunk.used++] = End;
+    put(chunk, game);
+    put(chunk, outcome.gameOver ? 1u : 0u);
+    put(chunk, static_cast<uint64_t>(outcome.week));
+    put(chunk, static_cast<uint64_t>(outcome.stars));
+    put(chunk, static_cast<uint64_t>(outcome.cause));
+    putStats(chunk, outcome.player);
+}
+
+} // namespace EventLog
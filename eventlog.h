@@ -0,0 +1,87 @@
+#ifndef EVENTLOG_H
+#define EVENTLOG_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "logformat.h"
+#include "player.h"
+#include "scenario.h"
+
+// Decision log: every scenario choice, every random event, and how each game ended, with the stat
+// changes each one caused, in a compact binary file for offline analysis (`--log FILE`; decode
+// with `logdump FILE > log.csv`).
+//
+// Each thread appends records to its own 64 KB chunk without locking. Full chunks are handed to a
+// background thread that writes them out, so games never wait on the disk; a thread's last chunk
+// is handed over by flush() or when the thread exits, and stop() (or a normal exit) writes whatever
+// remains. A process that is killed loses the records still buffered, up to 64 KB per thread; the
+// server flushes every loop's chunk when it is stopped with SIGINT or SIGTERM.
+// Records never span chunks. The file layout is in logformat.h.
+namespace EventLog {
+
+// start()
+// Opens the log and starts the writer thread.
+// Input: path and a string for the error message. Output: true if the file was opened.
+bool start(const std::string &path, std::string &error);
+
+// stop()
+// Writes every thread's buffered records, stops the writer, and closes the file. Threads that are
+// still logging must have stopped first. Later calls do nothing.
+// Input: none. Output: none.
+void stop();
+
+// flush()
+// Hands the calling thread's partly filled chunk to the writer, for threads that stay alive while
+// the log is stopped (e.g. server loops shutting down). Input: none. Output: none.
+void flush();
+
+// enabled()
+// Returns true while a log is open.
+bool enabled();
+
+// newGame()
+// Numbers a new game and logs its start.
+// Input: the game's seed, or 0. Output: game number (from 1), or 0 when no log is open.
+uint32_t newGame(uint32_t seed);
+
+// choice()
+// Logs a scenario choice. Input: game number, week, slot, choice index, choices unlocked, and the
+// stats before and after. Output: none.
+void choice(uint32_t game, int week, int slot, int choice, int available, const Player &before, const Player &after);
+
+// event()
+// Logs a random event. Input: game number, week, event name, and the stats before and after. Output: none.
+void event(uint32_t game, int week, std::string_view name, const Player &before, const Player &after);
+
+// end()
+// Logs how a game ended. Input: game number and outcome. Output: none.
+void end(uint32_t game, const Outcome &outcome);
+
+// Observer
+// Logs one game played outside a session (at the terminal) when installed with setGameObserver().
+class Observer : public GameObserver {
+public:
+    Observer() : game(enabled() ? newGame(0) : 0) {}
+
+    void gameEnded(const Outcome &outcome) override
+    {
+        if (game) end(game, outcome);
+    }
+    void choiceMade(int week, int slot, int index, int available, const Player &before, const Player &after) override
+    {
+        if (game) choice(game, week, slot, index, available, before, after);
+    }
+    void eventRan(int week, std::string_view name, const Player &before, const Player &after) override
+    {
+        if (game) event(game, week, name, before, after);
+    }
+
+private:
+    uint32_t game;
+};
+
+} // namespace EventLog
+
+#endif // EVENTLOG_H
@@ -0,0 +1,373 @@
+// Input fuzzer: plays complete games through runGame() the way the terminal does, but answers
+// every prompt with random and adversarial input: valid and out-of-range numbers, numbers too big
+// for an int, blank lines, text, stray whitespace, very long lines, and end of input. This covers
+// promptInt(), promptChar(), waitForEnter(), and the raw reads of the script read() builtin (the
+// scenarios' old "std::cin >> choice" prompts). Every game is checked as it runs:
+//   - stats are in range after every choice (once clampStats() has run), at every week's end, and
+//     at the ending;
+//   - the ending lists only the starting NPCs and the characters the content introduces on purpose,
+//     each once, so interactWith() never made one up from a mistyped or unmatched name;
+//   - the game reaches its ending, within a bounded number of prompts, and stops asking for input
+//     soon after the input ends (a prompt that re-asks forever at end of input is an infinite loop).
+//
+// Each game's content rolls and answers come from its seed, so a failure is replayed exactly with
+// `./fuzzer --replay SEED`, which prints the transcript with the answers echoed.
+//
+// Build and run with `make fuzz`.
+// Usage: ./fuzzer [--games N] [--seed N] [--threads N] | ./fuzzer --replay SEED
+// Must run from the directory holding scenarios.txt / scenarios.pack.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <coroutine>
+#include <cstdio>
+#include <cstdlib>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "arena.h"
+#include "catalog.h"
+#include "game.h"
+#include "output.h"
+#include "scenario.h"
+#include "util.h"
+
+namespace {
+
+const int kMaxPrompts = 2000;     // a game still asking after this many answers is a softlock
+const int kMaxReadsAfterEnd = 50; // reads allowed once the input has ended, before it counts as a loop
+const size_t kMaxReports = 20;    // failures listed in full; the rest are only counted
+
+// Characters that scenarios.txt adds with interact() on purpose, besides the starting ones.
+const char *const kIntroduced[] = {"New Crush"};
+
+// Text answers that are not a plain number in range.
+const char *const kJunk[] = {
+    "", " ", "\t", "abc", "y", "n", "yes", "No", "1.5", "+1", "-", "--1", "0x1", "1e3", "2 3", " 2", "3 ",
+    "1abc", "abc1", "9999999999", "-9999999999", "99999999999999999999999", "2147483648", "-2147483649",
+    "\xd9\xa1", "\xc3\xa9", "\x7f", "\x1b[A", "%d%s%n", "\\n",
+};
+
+// Input
+// The game's input: whole lines appended one answer at a time. Once the fuzzer ends the input, a
+// read that runs out sees end of file, as at a terminal after Ctrl-D.
+class Input : public std::streambuf {
+public:
+    void append(std::string_view text)
+    {
+        data.erase(0, static_cast<size_t>(gptr() - eback()));
+        data.append(text);
+        setg(&data[0], &data[0], &data[0] + data.size());
+    }
+
+protected:
+    int_type underflow() override
+    {
+        return gptr() == egptr() ? traits_type::eof() : traits_type::to_int_type(*gptr());
+    }
+
+private:
+    std::string data;
+};
+
+// inRange()
+// Returns true if every stat is within the range clampStats() enforces.
+bool inRange(const Player &p)
+{
+    auto ok = [](int value) { return value >= 0 && value <= 100; };
+    return ok(p.energy) && ok(p.health) && ok(p.social) && ok(p.academic) && ok(p.fitness) && p.money >= 0;
+}
+
+// describe()
+// Formats the six stats for a failure report.
+std::string describe(const Player &p)
+{
+    return "energy " + std::to_string(p.energy) + ", health " + std::to_string(p.health) + ", social " +
+           std::to_string(p.social) + ", academic " + std::to_string(p.academic) + ", fitness " +
+           std::to_string(p.fitness) + ", money " + std::to_string(p.money);
+}
+
+// Game
+// One fuzzed game. It is the game's input source, so every read parks until the fuzzer has chosen
+// an answer for the prompt, and its observer, so the invariants are checked as the game reports.
+class Game : private InputSource, private GameObserver {
+public:
+    // Game()
+    // Input: seed for the game's rolls and the fuzzer's answers, and whether to keep a transcript.
+    Game(uint32_t seed, bool transcribe) : stream(&input), capture(transcribe)
+    {
+        random.seed(seed);
+        std::seed_seq answers{seed, 4u}; // apart from the game's own streams (GameRandom::seed())
+        picks.seed(answers);
+        // Half the games run to their ending; the others lose their input partway through.
+        endChance = std::uniform_int_distribution<int>(0, 1)(picks) ? 0.0 : 1.0 / 40;
+    }
+
+    // play()
+    // Plays the game to its end, or until it is found stuck.
+    // Input: catalog and the arena the game allocates from. Output: none.
+    void play(const Content::Catalog &catalog, Arena &arena)
+    {
+        OutputSink *previousOut = setOutput(capture ? static_cast<OutputSink *>(&transcript) : &discard);
+        setInput(&stream, this);
+        bool previousDelays = setDelays(false);
+        std::pmr::memory_resource *previousMemory = setSessionMemory(&arena);
+        GameObserver *previousObserver = setGameObserver(this);
+        GameRandom *previousRandom = setGameRandom(&random);
+        {
+            Task<void> task = runGame(catalog, std::string());
+            task.start();
+            while (!task.done() && failure.empty()) {
+                if (!parked) {
+                    fail("parked without waiting for input");
+                } else if (ended) {
+                    fail("still asking for input after " + std::to_string(kMaxReadsAfterEnd) +
+                         " reads past the end of input");
+                } else if (prompts >= kMaxPrompts) {
+                    fail("no ending after " + std::to_string(kMaxPrompts) + " answers");
+                } else {
+                    answer();
+                    std::exchange(parked, nullptr).resume();
+                }
+            }
+            if (task.done() && !finished && failure.empty()) fail("returned without reaching an ending");
+        } // a stuck game's frames are destroyed here, while its arena and streams are still installed
+        setGameRandom(previousRandom);
+        setGameObserver(previousObserver);
+        setSessionMemory(previousMemory);
+        setDelays(previousDelays);
+        setInput(nullptr);
+        setOutput(previousOut);
+    }
+
+    const std::string &error() const { return failure; }
+    const std::string &text() const { return transcript.text(); }
+    int answers() const { return prompts; }
+
+private:
+    // answer()
+    // Chooses the parked prompt's answer and appends it, or ends the input.
+    void answer()
+    {
+        ++prompts;
+        if (endChance > 0 && std::uniform_real_distribution<double>(0.0, 1.0)(picks) < endChance) {
+            ended = true;
+            echo("[end of input]\n");
+            return;
+        }
+        // A blank line does not answer a number or y/n prompt (the read skips it), so keep adding
+        // lines until one does, as a player pressing Enter a few times would.
+        for (;;) {
+            std::string line = pick();
+            echo(line + "\n");
+            input.append(line + "\n");
+            if (prompt.kind == PromptKind::Continue || line.find_first_not_of(" \t\r\v\f") != std::string::npos) break;
+        }
+    }
+
+    // pick()
+    // Returns one line: mostly valid answers, with out-of-range numbers and junk mixed in.
+    std::string pick()
+    {
+        int roll = std::uniform_int_distribution<int>(0, 99)(picks);
+        if (roll < 10) return kJunk[std::uniform_int_distribution<size_t>(0, std::size(kJunk) - 1)(picks)];
+        if (roll < 12) return std::string(std::uniform_int_distribution<size_t>(1, 5000)(picks), '7');
+        switch (prompt.kind) {
+        case PromptKind::Choice:
+            if (roll < 20) {
+                const int edges[] = {prompt.min - 1, prompt.max + 1, 0, -1, INT_MAX, INT_MIN, prompt.max + 1000};
+                return std::to_string(edges[std::uniform_int_distribution<size_t>(0, std::size(edges) - 1)(picks)]);
+            }
+            return std::to_string(std::uniform_int_distribution<int>(prompt.min, prompt.max)(picks));
+        case PromptKind::Number:
+            if (roll < 30) return std::to_string(std::uniform_int_distribution<int>(INT_MIN, INT_MAX)(picks));
+            return std::to_string(std::uniform_int_distribution<int>(-2, 5)(picks));
+        case PromptKind::Confirm:
+            return roll < 55 ? "n" : roll < 90 ? "y" : "Y";
+        case PromptKind::Continue:
+        case PromptKind::None:
+            break;
+        }
+        return "";
+    }
+
+    // echo()
+    // Adds an answer to the transcript when one is kept.
+    void echo(const std::string &text)
+    {
+        if (capture) transcript << text;
+    }
+
+    // fail()
+    // Keeps the first failure; the game is abandoned once one is found.
+    void fail(const std::string &what)
+    {
+        if (failure.empty()) failure = what;
+    }
+
+    bool hasAnswer(PromptKind) const override
+    {
+        // Once the input has ended every read goes ahead and finds end of file; a game that keeps
+        // reading regardless is parked instead, so play() can report it.
+        return ended && ++readsAfterEnd <= kMaxReadsAfterEnd;
+    }
+
+    void wait(std::coroutine_handle<> reader, const Prompt &asked) override
+    {
+        parked = reader;
+        prompt = asked;
+    }
+
+    void choiceMade(int week, int slot, int, int available, const Player &, const Player &after) override
+    {
+        if (available < 1) fail("week " + std::to_string(week) + " scenario " + std::to_string(slot) + ": no choices");
+        if (!inRange(after)) {
+            fail("week " + std::to_string(week) + " scenario " + std::to_string(slot) +
+                 ": stats out of range after the choice: " + describe(after));
+        }
+    }
+
+    void weekEnded(int week, const Player &player) override
+    {
+        if (!inRange(player)) fail("week " + std::to_string(week) + " ended with stats out of range: " + describe(player));
+    }
+
+    void gameEnded(const Outcome &outcome) override
+    {
+        if (finished) fail("reported a second ending");
+        finished = true;
+        if (!inRange(outcome.player)) fail("ended with stats out of range: " + describe(outcome.player));
+        if (outcome.stars < 0 || outcome.stars > 5) fail("ended with " + std::to_string(outcome.stars) + " stars");
+        if (outcome.week < 1 || outcome.week > kSummerWeeks) fail("ended in week " + std::to_string(outcome.week));
+        if (!outcome.rels) return;
+        Relationships starting;
+        std::vector<std::string_view> known(std::begin(kIntroduced), std::end(kIntroduced));
+        for (const NPC &npc : starting.npcs) known.push_back(npc.name);
+        for (const NPC &npc : outcome.rels->npcs) {
+            std::string name(npc.name);
+            if (std::find(known.begin(), known.end(), npc.name) == known.end()) {
+                fail("ended with an NPC that was never introduced: \"" + name + "\"");
+            }
+            if (std::count_if(outcome.rels->npcs.begin(), outcome.rels->npcs.end(),
+                              [&npc](const NPC &other) { return other.name == npc.name; }) > 1) {
+                fail("ended with " + name + " listed twice");
+            }
+            if (npc.affinity < 0 || npc.affinity > 100) fail(name + " ended with affinity " + std::to_string(npc.affinity));
+        }
+    }
+
+    Input input;
+    std::istream stream;
+    bool capture;
+    CaptureSink transcript;
+    NullSink discard;
+    GameRandom random;
+    std::mt19937 picks;
+    double endChance = 0.0;
+    std::coroutine_handle<> parked;
+    Prompt prompt;
+    int prompts = 0;
+    bool ended = false;
+    mutable int readsAfterEnd = 0;
+    bool finished = false;
+    std::string failure;
+};
+
+// Totals
+// What the fuzzing threads found, shared between them.
+struct Totals {
+    std::mutex lock;
+    std::atomic<int> next{0};
+    std::atomic<long long> answers{0};
+    int failures = 0;
+    std::vector<std::pair<uint32_t, std::string>> reports;
+};
+
+// fuzz()
+// Plays games from the shared counter until all have been played.
+// Input: catalog, game count, first seed, and totals. Output: none.
+void fuzz(const Content::Catalog &catalog, int games, uint32_t seed, Totals &totals)
+{
+    Arena arena;
+    long long answers = 0;
+    for (int i = totals.next++; i < games; i = totals.next++) {
+        uint32_t gameSeed = seed + static_cast<uint32_t>(i);
+        Game game(gameSeed, false);
+        game.play(catalog, arena);
+        arena.release();
+        answers += game.answers();
+        if (!game.error().empty()) {
+            std::lock_guard<std::mutex> guard(totals.lock);
+            totals.failures++;
+            if (totals.reports.size() < kMaxReports) totals.reports.emplace_back(gameSeed, game.error());
+        }
+    }
+    totals.answers += answers;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    int games = 20000;
+    uint32_t seed = 1;
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    bool replay = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--games" && i + 1 < argc) {
+            games = std::atoi(argv[++i]);
+        } else if (arg == "--seed" && i + 1 < argc) {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threads = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--replay" && i + 1 < argc) {
+            seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+            replay = true;
+        } else {
+            std::fprintf(stderr, "Usage: %s [--games N] [--seed N] [--threads N] | %s --replay SEED\n", argv[0], argv[0]);
+            return 1;
+        }
+    }
+
+    std::string error;
+    std::shared_ptr<const Content::Catalog> catalog = Content::load("scenarios.txt", "scenarios.pack", error);
+    if (!catalog) {
+        std::fprintf(stderr, "Could not load content: %s\n", error.c_str());
+        return 1;
+    }
+
+    if (replay) {
+        Arena arena;
+        Game game(seed, true);
+        game.play(*catalog, arena);
+        std::fwrite(game.text().data(), 1, game.text().size(), stdout);
+        std::printf("\n[seed %u: %s]\n", seed, game.error().empty() ? "ok" : game.error().c_str());
+        return game.error().empty() ? 0 : 1;
+    }
+
+    Totals totals;
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&catalog, games, seed, &totals]() { fuzz(*catalog, games, seed, totals); });
+    }
+    for (std::thread &worker : workers) worker.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    std::sort(totals.reports.begin(), totals.reports.end());
+    for (const auto &report : totals.reports) std::printf("FAIL seed %u: %s\n", report.first, report.second.c_str());
+    std::printf("Fuzzed %d games (%lld answers) on %d threads in %.2f s: %.0f games/s, %d failed\n", games,
+                totals.answers.load(), threads, seconds, seconds > 0 ? games / seconds : 0.0, totals.failures);
+    if (totals.failures > 0) std::printf("Replay a failure with ./fuzzer --replay SEED\n");
+    return totals.failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,887 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "game.h"
+#include "activities.h"
+#include "balance.h"
+#include "catalog.h"
+#include "output.h"
+#include "player.h"
+#include "profile.h"
+#include "relationships.h"
+#include "savegame.h"
+#include "scenario.h"
+#include "trace.h"
+#include "util.h"
+
+/**
+ * printStatChanges()
+ * Prints the changes in player stats and relationships after a choice.
+ * Inputs:
+ *  - beforePlayer: Player object representing stats before the choice.
+ *  - afterPlayer: Player object representing stats after the choice.
+ *  - beforeRels: Relationships object before the choice.
+ *  - afterRels: Relationships object after the choice.
+ * Output: None (prints changes to the console).
+ */
+void printStatChanges(const Player& beforePlayer,
+                      const Player& afterPlayer,
+                      const Relationships& beforeRels,
+                      const Relationships& afterRels)
+{
+    out() << "\n--- RESULTING STAT CHANGES ---\n";
+    auto line = [](const char* label, int beforeVal, int afterVal) {
+        if (beforeVal == afterVal) return;
+        int delta = afterVal - beforeVal;
+        out() << label << ": " << beforeVal << " -> " << afterVal
+                  << " (" << (delta > 0 ? "+" : "") << delta << ")\n";
+    };
+
+    line("Energy",   beforePlayer.energy,   afterPlayer.energy);
+    line("Health",   beforePlayer.health,   afterPlayer.health);
+    line("Social",   beforePlayer.social,   afterPlayer.social);
+    line("Academic", beforePlayer.academic, afterPlayer.academic);
+    line("Fitness",  beforePlayer.fitness,  afterPlayer.fitness);
+    line("Money",    beforePlayer.money,    afterPlayer.money);
+
+    // Relationship affinity changes
+    bool anyAffinityChange = false;
+    for (const auto& npcAfter : afterRels.npcs) {
+        int beforeAffinity = 0;
+        bool found = false;
+        for (const auto& npcBefore : beforeRels.npcs) {
+            if (npcBefore.name == npcAfter.name) {
+                beforeAffinity = npcBefore.affinity;
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            // New relationship created this step.
+            beforeAffinity = 0;
+        }
+        if (beforeAffinity == npcAfter.affinity) continue;
+        if (!anyAffinityChange) {
+            out() << "\n--- RELATIONSHIP CHANGES ---\n";
+            anyAffinityChange = true;
+        }
+        int delta = npcAfter.affinity - beforeAffinity;
+        out() << npcAfter.name << ": " << beforeAffinity << " -> " << npcAfter.affinity
+                  << " (" << (delta > 0 ? "+" : "") << delta << ")\n";
+    }
+
+    delay(500);
+}
+
+/**
+ * applyEffect()
+ * Applies the effects of a choice to the player's stats and relationships.
+ * Inputs:
+ *  - player: Player object to modify based on the effect.
+ *  - rels: Relationships object to modify based on affinity changes in the effect.
+ *  - effect: Effect object describing the stat and relationship changes.
+ *  - diff: DifficultySettings object to scale energy costs based on difficulty.
+ * Output: Modifies the Player and Relationships objects in place.
+ */
+void applyEffect(Player& player, Relationships& rels, const Effect& effect, const DifficultySettings& diff)
+{
+    PROFILE_SCOPE(ApplyEffect);
+    int energyDelta = effect.energy;
+    if (energyDelta < 0) {
+        energyDelta = static_cast<int>(std::lround(energyDelta * diff.energyCostMultiplier));
+    }
+    player.adjustEnergy(energyDelta);
+    player.adjustHealth(effect.health);
+    player.adjustSocial(effect.social);
+    player.adjustAcademic(effect.academic);
+    player.adjustFitness(effect.fitness);
+    player.adjustMoney(effect.money);
+
+    for (const auto& entry : effect.affinityDeltas) {
+        rels.interactWith(entry.first, entry.second);
+    }
+}
+
+/**
+ * enforceCriticalRules()
+ * Enforces critical rules for health, energy, and money. Handles game-over conditions or automatic recovery actions.
+ * Inputs:
+ *  - state: GameState object to track game-over or scenario-skipping flags.
+ *  - player: Player object to check for critical thresholds and adjust stats if necessary.
+ * Output: Modifies GameState and Player objects based on critical conditions.
+ */
+void enforceCriticalRules(GameState& state, Player& player)
+{
+    PROFILE_SCOPE(CriticalRules);
+    if (player.money <= 0) {
+        out() << "[CRITICAL] FINANCIAL CRISIS! You ran out of money. GAME OVER.\n";
+        state.gameOver = true;
+        state.gameOverCause = GameOverCause::Bankrupt;
+        return;
+    }
+
+    if (player.health <= 10) {
+        out() << "[WARNING] MEDICAL EMERGENCY! Forced hospital visit (-$100, +30 health, +20 energy).\n";
+        player.adjustMoney(-100);
+        player.adjustHealth(30);
+        player.adjustEnergy(20);
+        state.hospitalVisits++;
+    }
+
+    if (player.energy <= 0) {
+        out() << "[WARNING] COLLAPSE FROM EXHAUSTION! Forced sleep, skipping next scenario.\n";
+        player.adjustEnergy(40);
+        state.skipNextScenario = true;
+        state.collapses++;
+    }
+
+    player.clampStats();
+}
+
+/**
+ * printRelationships()
+ * Prints the current affinity levels for all known NPCs.
+ * Inputs:
+ *  - rels: Relationships object containing NPCs and their affinity levels.
+ * Output: Displays the relationship affinities to the console.
+ */
+void printRelationships(const Relationships& rels)
+{
+    out() << "==== RELATIONSHIPS ====\n";
+    for (const auto& npc : rels.npcs) {
+        out() << " - " << npc.name << ": " << npc.affinity << "\n";
+    }
+}
+
+/**
+ * startDifficulty()
+ * Sets up a new game from a difficulty preset and shows the starting stats.
+ * Inputs:
+ *  - player: Player object to initialize with the preset's starting stats.
+ *  - preset: DifficultyPreset for the chosen level.
+ * Output:
+ *  - Returns the preset's DifficultySettings.
+ */
+DifficultySettings startDifficulty(Player& player, const DifficultyPreset& preset)
+{
+    player = preset.start;
+    DifficultySettings settings = preset.settings;
+
+  out() << "Starting stats set for " << settings.name << " mode.\n";
+  player.printStats();
+  return settings;
+}
+
+/**
+ * chooseDifficulty()
+ * Prompts the user to select a difficulty level and initializes the player's starting stats accordingly.
+ * Inputs:
+ *  - player: Player object to initialize with starting stats based on difficulty.
+ *  - difficultyIndex: Output parameter to store the chosen difficulty level (1 = Easy, 2 = Medium, 3 = Hard).
+ *  - balance: Balance providing the difficulty presets.
+ * Output:
+ *  - Returns a DifficultySettings object corresponding to the chosen difficulty level.
+ */
+Task<DifficultySettings> chooseDifficulty(Player& player, int& difficultyIndex, const Balance& balance)
+{
+    out() << "Choose your difficulty:\n";
+    out() << "1. Trust Fund Kid (Easy) - Life on easy mode, just don't screw up\n";
+    out() << "2. Average Student (Medium) - Typical college student struggles\n";
+    out() << "3. Struggling Immigrant (Hard) - Provide for family, higher costs\n";
+    out() << "Please input 1, 2, or 3\n";
+
+    int choice = co_await promptInt(1, 3);
+    difficultyIndex = choice;
+    co_return startDifficulty(player, balance.presets[choice]);
+}
+
+/**
+ * difficultyFromIndex()
+ * Returns the DifficultySettings object corresponding to the given difficulty index.
+ * Inputs:
+ *  - index: Integer representing the difficulty level (1 = Easy, 2 = Medium, 3 = Hard).
+ *  - balance: Balance providing the difficulty presets.
+ * Output:
+ *  - A DifficultySettings object for the specified difficulty level.
+ */
+DifficultySettings difficultyFromIndex(int index, const Balance& balance)
+{
+    return balance.presets[index >= 1 && index <= 3 ? index : 3].settings;
+}
+
+/**
+ * applyWeekEnd()
+ * Applies weekly effects such as stat decay, allowances, deductions, and random events.
+ * Inputs:
+ *  - week: Integer representing the current week.
+ *  - state: GameState object to track game progress and flags.
+ *  - player: Player object to modify based on weekly effects.
+ *  - rels: Relationships object to modify based on random events or affinity changes.
+ *  - diff: DifficultySettings object to scale decay and manage allowances/deductions.
+ *  - decay: WeekDecay row for this week, or null when the table has no row for it.
+ *  - catalog: content catalog providing the week-end random event scripts.
+ * Output: Modifies Player, Relationships, and GameState objects in place.
+ */
+Task<void> applyWeekEnd(int week, GameState& state, Player& player, Relationships& rels, const DifficultySettings& diff,
+                  const WeekDecay* decay, const Content::Catalog& catalog)
+{
+    PROFILE_SCOPE(WeekEnd);
+    TRACE_SPAN("week end", "week", week);
+    // Small pause before the end-of-week summary block.
+    delay(500);
+    out() << "\n[WEEK END] --- End of Week " << week << " ---\n";
+
+    if (diff.weeklyAllowance > 0 && (!diff.allowanceNeedsGrades || player.academic > 60)) {
+        player.adjustMoney(diff.weeklyAllowance);
+        out() << "[MONEY] Allowance received: $" << diff.weeklyAllowance << "\n";
+    }
+    if (diff.weeklyDeduction > 0) {
+        player.adjustMoney(-diff.weeklyDeduction);
+        out() << "[MONEY] Sent money home: -$" << diff.weeklyDeduction << "\n";
+    }
+    if (state.employed) {
+        player.adjustMoney(100);
+        out() << "[MONEY] Paycheck from part-time work: +$100\n";
+    }
+
+    if (decay) {
+        const WeekDecay& d = *decay;
+        player.adjustEnergy(static_cast<int>(std::lround(d.energy * diff.decayMultiplier)));
+        player.adjustHealth(static_cast<int>(std::lround(d.health * diff.decayMultiplier)));
+        player.adjustSocial(static_cast<int>(std::lround(d.social * diff.decayMultiplier)));
+        player.adjustAcademic(static_cast<int>(std::lround(d.academic * diff.decayMultiplier)));
+        player.adjustFitness(static_cast<int>(std::lround(d.fitness * diff.decayMultiplier)));
+        out() << "Stat decay applied for the week.\n";
+    }
+
+    if (week == 1) {
+        if (player.academic > 40) {
+            player.adjustMoney(30);
+            out() << "[FAMILY] Parents proud of academics: +$30\n";
+        } else if (player.academic < 20) {
+            player.adjustSocial(-10);
+            out() << "[FAMILY] Parents concerned about grades: Social -10\n";
+        } else {
+            player.adjustMoney(30);
+            out() << "[FAMILY] Standard allowance: +$30\n";
+        }
+    }
+
+    // Week-specific story events based on the design/game flow.
+    if (week == 2 || week == 3 || week == 4 || week == 5 || week == 6 || week == 7) {
+        co_await catalog.runEvent("weekEndRandomEvents", state, player, rels);
+    } else if (week == 8) {
+        delay(1500);
+        out() << "\nWEEK 8 COMPLETE: \"Summer concludes – the final outcomes of your choices are revealed.\"\n";
+
+        // Path-based wrap-up.
+        if (state.relationshipPath == "partner" && !state.partnerName.empty()) {
+            out() << "[PATH] Partner path: You leave with a strong bond.\n";
+            rels.interactWith(state.partnerName, 25);
+        } else if (state.relationshipPath == "single") {
+            out() << "[PATH] Single path: You leave with wide social circles.\n";
+            player.adjustSocial(20);
+        } else if (state.relationshipPath == "drama") {
+            out() << "[PATH] Drama/polyamory path: You leave with mixed reputations.\n";
+            player.adjustSocial(-10);
+            if (!rels.npcs.empty()) {
+                std::uniform_int_distribution<int> dist(0, static_cast<int>(rels.npcs.size()) - 1);
+                int idx = dist(rng());
+                rels.interactWith(rels.npcs[idx].name, -15);
+            }
+        } else if (state.relationshipPath == "avoidance") {
+            out() << "[PATH] Avoidance path: You leave rested but isolated.\n";
+            player.adjustHealth(15);
+            player.adjustSocial(-10);
+        }
+
+        // Additional Week 8 random events based on path.
+        co_await catalog.runEvent("weekEndRandomEvents", state, player, rels);
+    }
+
+    if (week == 6 && state.relationshipPath == "partner" && !state.partnerName.empty()) {
+        rels.interactWith(state.partnerName, 15);
+        out() << "[RELATIONSHIP] Relationship solidifies with " << state.partnerName << ".\n";
+    }
+
+    // Additional weekly random events from the legacy event pool.
+    co_await catalog.runEvent("weeklyRandomEvents", state, player, rels);
+
+    player.clampStats();
+    player.printStats();
+    printRelationships(rels);
+    state.skipNextScenario = false;
+}
+
+// starsFromStats()
+// Derives a 0–5 "star" rating from final stats, with 0 meaning critical failure.
+// Input: final Player stats. Output: integer rating in [0,5].
+// endingDescriptionFromStats()
+// Returns a thematic ending name and description based on final stats.
+std::pair<std::string_view, std::string_view> endingDescriptionFromStats(const Player& p)
+{
+    bool ultraChad =
+        p.money   > 1200 &&
+        p.fitness > 70   &&
+        p.social  > 70   &&
+        p.academic > 70  &&
+        p.health  > 70;
+
+    bool balanced =
+        p.money   > 900 &&
+        p.health  > 50   &&
+        p.energy  > 50   &&
+        p.social  > 50   &&
+        p.academic > 50  &&
+        p.fitness > 50;
+
+    bool workaholic =
+        p.money   > 1500 &&
+        p.social  < 50   &&
+        p.fitness < 50;
+
+    bool gymBro =
+        p.fitness > 80   &&
+        p.academic < 50  &&
+        p.money   < 600;
+
+    bool noLife =
+        p.academic > 80  &&
+        p.social   < 50  &&
+        p.fitness  < 40;
+
+    bool socialButterfly =
+        p.social  > 80   &&
+        p.money   < 500  &&
+        p.academic < 50;
+
+    int below40 = 0;
+    below40 += (p.health   < 40);
+    below40 += (p.energy   < 40);
+    below40 += (p.social   < 40);
+    below40 += (p.academic < 40);
+    below40 += (p.fitness  < 40);
+    below40 += (p.money    < 40);
+    bool barelySurvived = below40 >= 3;
+
+    if (ultraChad) {
+        return {"Ultra Chad Ending",
+                "You crushed this summer! Perfect body, perfect grades, loaded wallet, and an amazing social life. You're basically a superhero!"};
+    }
+    if (balanced) {
+        return {"Balanced Ending",
+                "Solid summer! You managed to improve in all areas without going overboard. Future you thanks present you."};
+    }
+    if (workaholic) {
+        return {"Workaholic Ending",
+                "You're rich but at what cost? Your Tinder matches have dried up and you get winded climbing stairs."};
+    }
+    if (gymBro) {
+        return {"Gym Bro Ending",
+                "You're absolutely shredded! Too bad you failed your summer courses and can't afford protein powder anymore."};
+    }
+    if (noLife) {
+        return {"No-life Ending",
+                "Straight A's! Your parents are proud but your only friend is the library security guard."};
+    }
+    if (socialButterfly) {
+        return {"Social Butterfly Ending",
+                "You're the life of the party! Unfortunately, you partied so much you forgot about real life responsibilities."};
+    }
+    if (barelySurvived) {
+        return {"Barely Survived Ending",
+                "You made it through summer but... was this really living? Time to reflect on your life choices."};
+    }
+
+    // Default: treat as a middling, mixed summer.
+    return {"Mixed Results Ending",
+            "You survived the summer with a mix of highs and lows. There's plenty to be proud of—and plenty to improve next time."};
+}
+
+// starsFromStats()
+// Simple wrapper that derives a 1–5 rating from the named ending.
+int starsFromStats(const Player& p)
+{
+    auto ending = endingDescriptionFromStats(p);
+    std::string_view name = ending.first;
+    if (name == "Ultra Chad Ending") return 5;
+    if (name == "Balanced Ending") return 4;
+    if (name == "Workaholic Ending" ||
+        name == "Gym Bro Ending" ||
+        name == "No-life Ending" ||
+        name == "Social Butterfly Ending") return 3;
+    if (name == "Barely Survived Ending") return 2;
+    return 3; // Mixed results or other custom endings.
+}
+
+// knownPath()
+// Returns the relationship path as static text, so it outlives the game; unknown paths are "other".
+// Input: path from the game state. Output: the path name.
+std::string_view knownPath(std::string_view path)
+{
+    static const std::string_view paths[] = {"open", "partner", "single", "drama", "avoidance"};
+    for (std::string_view known : paths) {
+        if (path == known) return known;
+    }
+    return "other";
+}
+
+// reportOutcome()
+// Tells the thread's observer, if any, how the game ended.
+// Input: final game objects, what ended the game (None if it was survived), and the ending name and
+// rating. A game over with no cause given was ended by a content script. Output: none.
+void reportOutcome(const GameState& state, const Player& player, const Relationships& rels, GameOverCause cause,
+                   std::string_view ending = std::string_view(), int stars = 0)
+{
+    GameObserver* observer = gameObserver();
+    if (!observer) return;
+    Outcome outcome;
+    outcome.gameOver = state.gameOver || cause != GameOverCause::None;
+    outcome.week = state.currentWeek;
+    outcome.ending = ending;
+    outcome.stars = stars;
+    outcome.cause = outcome.gameOver && cause == GameOverCause::None ? GameOverCause::Story : cause;
+    outcome.path = knownPath(state.relationshipPath);
+    outcome.hospitalVisits = state.hospitalVisits;
+    outcome.collapses = state.collapses;
+    outcome.player = player;
+    outcome.rels = &rels;
+    observer->gameEnded(outcome);
+}
+
+// reportWeek()
+// Tells the thread's observer, if any, the player's stats at the end of a week.
+// Input: week and player. Output: none.
+void reportWeek(int week, const Player& player)
+{
+    if (GameObserver* observer = gameObserver()) observer->weekEnded(week, player);
+}
+
+// reportChoice()
+// Tells the thread's observer, if any, which choice was made and what it changed.
+// Input: week, slot, choice index, number of unlocked choices, and stats before and after. Output: none.
+void reportChoice(int week, int slot, int choice, int available, const Player& before, const Player& after)
+{
+    if (GameObserver* observer = gameObserver()) observer->choiceMade(week, slot, choice, available, before, after);
+}
+
+// runClosingSequence()
+// Plays the final cinematic sequence, shows final checks and rating, and clears any save file.
+// Input: final GameState, Player, Relationships, and the save file path (empty when saving is disabled).
+Task<void> runClosingSequence(GameState& state, Player& player, Relationships& rels, const std::string& savePath)
+{
+    out() << "\nCLOSING SEQUENCE\n";
+    if (state.gameOver) {
+        out() << "You could not survive the summer. Better luck next time.\n";
+        reportOutcome(state, player, rels, state.gameOverCause);
+        SaveGame::clear(savePath);
+        co_return;
+    }
+
+    // Scene setup
+    out() << "[SCENE: Campus Quad, sunset of the final summer day]\n";
+    delay(2000);
+
+    out() << "The semester is over. Your summer journey has reached its end.\n\n";
+    delay(2000);
+
+    // Reflective final check
+    out() << "[FINAL CHECK]\n";
+    out() << "• Did you survive all 8 weeks without hitting critical warnings?\n";
+    out() << "• Did you balance your stats and relationships?\n";
+    out() << "• Did you achieve your chosen path's ending?\n\n";
+    delay(2000);
+
+    // Results header
+    out() << "[RESULTS APPEAR]\n\n";
+    out() << "\"WELCOME TO SUMMER MAXXING — FINAL REPORT!\"\n\n";
+
+    // Final performance summary
+    out() << "YOUR PERFORMANCE:\n";
+    out() << "• ⚡ ENERGY: "   << player.energy   << "\n";
+    out() << "• ❤️ HEALTH: "   << player.health   << "\n";
+    out() << "• 👥 SOCIAL: "   << player.social   << "\n";
+    out() << "• 📚 ACADEMIC: " << player.academic << "\n";
+    out() << "• 💪 FITNESS: "  << player.fitness  << "\n";
+    out() << "• 💰 MONEY: "    << player.money    << "\n";
+    out() << "• RELATIONSHIPS:\n";
+    printRelationships(rels);
+
+    delay(2000);
+
+    // Pass / fail conditions
+    out() << "\nPASS / FAIL CONDITIONS:\n";
+    if (player.health <= 0) {
+        out() << "🚨 You collapsed from illness. GAME OVER.\n";
+        reportOutcome(state, player, rels, GameOverCause::Illness);
+        SaveGame::clear(savePath);
+        co_return;
+    }
+    if (player.energy <= 0) {
+        out() << "😴 You collapsed from exhaustion. GAME OVER.\n";
+        reportOutcome(state, player, rels, GameOverCause::Exhaustion);
+        SaveGame::clear(savePath);
+        co_return;
+    }
+    if (player.money <= 0) {
+        out() << "💸 Financial crisis hit. GAME OVER.\n";
+        reportOutcome(state, player, rels, GameOverCause::Broke);
+        SaveGame::clear(savePath);
+        co_return;
+    }
+
+    out() << "✅ You survived the summer!\n\n";
+
+    auto ending1 = endingDescriptionFromStats(player);
+    out() << "ENDING: " << ending1.first << "\n";
+    out() << ending1.second << "\n\n";
+
+    int stars = starsFromStats(player);
+    reportOutcome(state, player, rels, GameOverCause::None, ending1.first, stars);
+
+    out() << "ENDING RATING (Stars out of 5): " << stars << "/5\n";
+    if (stars == 5) {
+        out() << "5/5 \"Legendary Summer!\" — You mastered balance, thrived socially, and left with strong bonds.\n";
+    } else if (stars == 4) {
+        out() << "4/5 \"Great Summer!\" — You did well, with only minor struggles.\n";
+    } else if (stars == 3) {
+        out() << "3/5 \"Average Summer.\" — You survived, but missed key opportunities.\n";
+    } else if (stars == 2) {
+        out() << "2/5 \"Rough Summer.\" — You barely scraped by, stats suffered.\n";
+    } else {
+        out() << "1/5 \"Disaster Summer.\" — You failed to balance life, relationships, or finances.\n";
+    }
+
+    delay(1000);
+    out() << "\nThank you for playing SUMMER MAXXING!\n";
+    delay(1000);
+    out() << "Your choices shaped your destiny. Every summer tells a different story.\n";
+    out() << "[Press Enter to exit...]\n";
+    co_await waitForEnter();
+
+    // Game completed successfully: clear any existing save file.
+    SaveGame::clear(savePath);
+}
+
+// runGame()
+// Main game loop: handles difficulty/load selection, iterates weeks/scenarios, and prints the final ending.
+// Input: content catalog (each week's scenarios are loaded when the week starts and released when it ends),
+// the save file path (an empty path disables the load and save prompts), the balance values to play
+// with, and a difficulty (1-3) to start on without asking, or 0 to let the player choose.
+// Output: runs the interactive session and prints results. The game is a coroutine that parks
+// whenever it waits for input, so it takes the path by value to keep it alive across suspensions.
+Task<void> runGame(const Content::Catalog& catalog, std::string savePath, const Balance& balance, int difficulty)
+{
+    Player player;
+    Relationships rels;
+    GameState state;
+    out() << "\n";
+    out() << "------------------------------------------------------\n";
+    out() << "*** For the best user experience, it is recommended to play in FullScreen.***\n";
+    out() << "------------------------------------------------------\n";
+
+
+    delay(4000);
+
+    out() << "------------------------------------------------------\n";
+    out() << "____  _     _      _      _____ ____    \n";
+    out() << "/ ___\\/ \\\\ /\\/ \\\\__/|/ \\\\__/|/  __//  __\\\\   \n";
+    out() << "|    \\\\| | ||| |\\\\/||| |\\\\/|||  \\\\  |  \\\\/|   \n";
+    out() << "\\\\___ || \\\\_/|| |  ||| |  |||  /_ |    /   \n";
+    out() << "\\\\____/\\\\____/\\\\_/  \\\\|\\\\_/  \\\\|\\\\____\\\\\\\\_/\\\\_\\\\   \n";
+    out() << "                                         \n";
+    out() << " _      ____ ___  ____  _ _  _      _____\n";
+    out() << "/ \\\\__/|/  _ \\\\  \\\\//\\\\  \\\\/// \\\\/ \\\\  /|/  __/\n";
+    out() << "| |\\\\||| / \\\\| \\\\  /  \\\\  / | || |\\\\ ||| |  _\n";
+    out() << "| |  ||| |-|| /  \\\\  /  \\\\ | || | \\\\||| |_//\n";
+    out() << "\\\\_/  \\\\|\\\\_/ \\\\|/__/\\\\/__/\\\\\\\\_/\\\\_/  \\\\|\\\\____\\\\\n";
+    out() << "                                            \n";
+    out() << "          |\n";
+    out() << "        \\\\ _ /\n";
+    out() << "      -= (_) =-\n";
+    out() << "        /   \\\\         _\\\\/_\n";
+    out() << "          |           //o\\\\  _\\\\/_\n";
+    out() << "   _____ _ __ __ ____ _ | __/o\\\\\\\\ _\n";
+    out() << " =-=-_-__=_-= _=_=-=_,-'|\"'\"\"-|-,_\n";
+    out() << "  =- _=-=- -_=-=_,-\"          |=- =- \n";
+    out() << "-=.--\"\n";
+    out() << "------------------------------------------------------\n\n";
+    
+    delay(1000);
+
+    out() << "[SCENE: Your dorm room, final exam week]\n";
+
+    delay(1000);
+
+    out() << "Another semester down! Time to make this summer COUNT.\n";
+
+    delay(1000);
+
+    out() << "Your goal: Survive 8 weeks while balancing relationships, fitness, academics, and finances.\n\n";
+
+    delay(1000);
+
+
+    // Offer to load an existing save (player stats + week) before starting a new run.
+    bool loaded = false;
+    DifficultySettings diff;
+    int difficultyIndex = 2;
+    if (!savePath.empty()) {
+        out() << "Load existing save from " << savePath << "? (y/n)\n";
+        char loadChoice = co_await promptChar();
+        if (loadChoice == 'y' || loadChoice == 'Y') {
+            int savedWeek = 1;
+            int savedScenario = 0;
+            if (SaveGame::load(player, savedWeek, savedScenario, savePath)) {
+                out() << "Loaded save at week " << savedWeek << ".\n";
+                state.currentWeek = savedWeek;
+                difficultyIndex = savedScenario;
+                if (difficultyIndex < 1 || difficultyIndex > 3) {
+                    difficultyIndex = 2; // default to Medium if invalid
+                }
+                diff = difficultyFromIndex(difficultyIndex, balance);
+                loaded = true;
+            } else {
+                out() << "No valid save found. Starting a new game.\n";
+            }
+        }
+    }
+
+    if (!loaded && difficulty >= 1 && difficulty <= Balance::kDifficulties) {
+        // Preset games (bots, tuning runs) start on the given difficulty without asking.
+        difficultyIndex = difficulty;
+        diff = startDifficulty(player, balance.presets[difficulty]);
+    } else if (!loaded) {
+        out() << "\n[DIFFICULTY SELECTION]\n";
+        out() << "► Trust Fund Kid (Easy) - \"Life on easy mode, just don't screw up\"\n";
+        out() << "► Average Student (Medium) - \"Typical college student struggles\"\n";
+        out() << "► Struggling Immigrant (Hard) - \"Got a family back home to provide for so you better work hard buddy\"\n";
+        diff = co_await chooseDifficulty(player, difficultyIndex, balance);
+    }
+
+    out() << "\n\"WELCOME TO SUMMER MAXXING!\"\n\n";
+
+    out() << "YOUR MISSION:\n";
+    out() << "Survive 8 weeks of summer while balancing your stats and relationships.\n";
+    out() << "Make smart choices to achieve your ideal summer ending!\n\n";
+
+    out() << "- KEY STATS TO MANAGE:\n";
+    out() << "- ENERGY (0-100) - Required for all activities\n";
+    out() << "- HEALTH (0-100) - Affects everything you do\n";
+    out() << "- SOCIAL (0-100) - Friendships and relationships\n";
+    out() << "- ACADEMIC (0-100) - Summer courses and learning\n";
+    out() << "- FITNESS (0-100) - Physical health and appearance\n";
+    out() << "- MONEY ($0-5000) - Campus life isn't free!\n\n";
+
+    out() << "CRITICAL WARNINGS:\n";
+    out() << "- If HEALTH <= 10: Medical emergency! Forced hospital visit\n";
+    out() << "- If ENERGY <= 10: Collapse from exhaustion! Forced sleep\n";
+    out() << "- If MONEY <= 0: Financial crisis! GAME OVER\n\n";
+
+    out() << "RELATIONSHIP SYSTEM:\n";
+    out() << "• Meet Alex (Gym), Sam (Library), Riley (Cafe), Jordan (Online)\n";
+    out() << "• Build affinity through interactions\n";
+    out() << "• Relationships unlock special opportunities and storylines\n\n";
+
+    out() << "HOW TO PLAY:\n";
+    out() << "• The summer has 8 weeks\n";
+    out() << "• Each week has 4 scenarios (like time slots)\n";
+    out() << "• Choose activities that balance your stats\n";
+    out() << "• Random events will spice things up\n\n";
+
+    out() << "TIPS FOR SUCCESS:\n";
+    out() << "• Don't neglect any stat for too long\n";
+    out() << "• Balance work, rest, and social life\n";
+    out() << "• Build relationships consistently\n";
+    out() << "• Watch your Energy levels\n";
+    out() << "• Save money for emergencies\n\n";
+
+    out() << "READY TO MAX YOUR SUMMER?\n";
+    out() << "Please note that you can pause and save/exit the game at the end of each week!\n";
+    co_await waitForEnter();
+
+    const int TOTAL_WEEKS = 8;
+
+    for (int week = state.currentWeek; week <= TOTAL_WEEKS && !state.gameOver; ++week) {
+        TRACE_SPAN("week", "week", week);
+        state.currentWeek = week;
+        // Only the current week's scenarios are kept; the previous week's text is released.
+        catalog.releaseWeek(week - 1);
+        const std::pmr::vector<Scenario> scenarios = catalog.loadWeek(week);
+        out() << "\n====================================\n";
+        out() << "              WEEK " << week << "\n";
+        out() << "====================================\n";
+        for (int slot = 1; slot <= 4 && !state.gameOver; ++slot) {
+            PROFILE_SCOPE(Turn);
+            TRACE_SPAN("scenario", "slot", slot);
+            if (state.skipNextScenario) {
+                out() << "You recover this scenario due to exhaustion.\n";
+                state.skipNextScenario = false;
+                continue;
+            }
+
+            auto it = scenarios.end();
+            {
+                PROFILE_SCOPE(ScenarioLookup);
+                it = std::find_if(scenarios.begin(), scenarios.end(), [&](const Scenario& sc) {
+                    return sc.week == week && sc.index == slot;
+                });
+            }
+            if (it == scenarios.end()) continue;
+            const Scenario& sc = *it;
+
+            // Show current stats and relationships before each decision.
+            {
+                PROFILE_SCOPE(Display);
+                player.printStats();
+                printRelationships(rels);
+            }
+
+            // Brief pause before showing the scenario text block.
+            delay(500);
+
+            out() << "\n------------------------------------\n";
+            out() << "Scenario " << slot << " - " << sc.location << "\n";
+            out() << "------------------------------------\n";
+            out() << sc.prompt << "\n";
+
+            std::pmr::vector<int> availableIndices(sessionMemory());
+            for (size_t i = 0; i < sc.choices.size(); ++i) {
+                const auto& c = sc.choices[i];
+                bool ok = c.isAvailable(state, player, rels);
+                if (ok) {
+                    availableIndices.push_back(static_cast<int>(i));
+                    out() << "  " << availableIndices.size() << ") " << c.title << "" << c.detail << "\n";
+                } else {
+                    out() << "  - " << c.title << " [locked: " << c.lockReason << "]\n";
+                }
+            }
+
+            if (availableIndices.empty()) {
+                out() << "No available actions. You rest instead.\n";
+                player.adjustEnergy(15);
+                continue;
+            }
+
+            Decision decision;
+            decision.scenario = &sc;
+            decision.available = availableIndices.data();
+            decision.count = static_cast<int>(availableIndices.size());
+            decision.state = &state;
+            decision.player = &player;
+            decision.rels = &rels;
+            int selection = co_await promptInt(1, decision.count, &decision);
+            const Choice& chosen = sc.choices[availableIndices[selection - 1]];
+            Player beforeChoice = player;
+            Relationships beforeRels = PROFILE_CALL(Snapshot, rels);
+            {
+                TRACE_SPAN("choice", "choice", availableIndices[selection - 1], chosen.title);
+                applyEffect(player, rels, chosen.effect, diff);
+                co_await chosen.runScript(state, player, rels);
+
+                enforceCriticalRules(state, player);
+                player.clampStats();
+            }
+            reportChoice(week, slot, availableIndices[selection - 1], decision.count, beforeChoice, player);
+            PROFILE_CALL(Display, printStatChanges(beforeChoice, player, beforeRels, rels));
+
+            // Week 1 special random events happen between scenarios; none run once the game is over.
+            if (state.gameOver) continue;
+            if (week == 1) {
+                co_await catalog.runEvent("week1RandomEvent", state, player, rels);
+            } else if (week == 5 && slot == 2) {
+                // Week 5 special random social event between scenarios 2 and 3.
+                co_await catalog.runEvent("week5MidweekSocialSpice", state, player, rels);
+            }
+        }
+
+        if (!state.gameOver) {
+            const WeekDecay* decay = week <= Balance::kWeeks ? &balance.decay[week] : nullptr;
+            co_await applyWeekEnd(week, state, player, rels, diff, decay, catalog);
+            reportWeek(week, player);
+
+            // Simple save option at the end of each week (not offered when saving is disabled).
+            if (!savePath.empty()) {
+                out() << "Save and quit? (y/n)\n";
+                char saveChoice = co_await promptChar();
+                if (saveChoice == 'y' || saveChoice == 'Y') {
+                    // Save the *next* week to play so loading resumes after the last completed week.
+                    int resumeWeek = std::min(week + 1, TOTAL_WEEKS);
+                    if (SaveGame::save(player, resumeWeek, difficultyIndex, savePath)) {
+                        out() << "Game saved to " << savePath << ".\n";
+                    } else {
+                        out() << "Failed to save game.\n";
+                    }
+                    co_return;
+                }
+            }
+        }
+    }
+
+    co_await runClosingSequence(state, player, rels, savePath);
+    co_return;
+
+    out() << "\nCLOSING SEQUENCE\n";
+    if (state.gameOver) {
+        out() << "You could not survive the summer. Better luck next time.\n";
+        SaveGame::clear(savePath);
+        co_return;
+    }
+
+    out() << "[SCENE: Campus Quad, sunset of the final summer day]\n";
+    out() << "The semester is over. Your summer journey has reached its end.\n\n";
+
+    out() << "\"WELCOME TO SUMMER MAXXING — FINAL REPORT!\"\n";
+
+    player.printStats();
+    printRelationships(rels);
+
+    // Pass / fail conditions.
+    if (player.health <= 0) {
+        out() << "You collapsed from illness. GAME OVER.\n";
+        SaveGame::clear(savePath);
+        co_return;
+    }
+    if (player.energy <= 0) {
+        out() << "You collapsed from exhaustion. GAME OVER.\n";
+        SaveGame::clear(savePath);
+        co_return;
+    }
+    if (player.money <= 0) {
+        out() << "Financial crisis hit. GAME OVER.\n";
+        SaveGame::clear(savePath);
+        co_return;
+    }
+
+    out() << "You survived the summer!\n";
+
+    auto ending2 = endingDescriptionFromStats(player);
+    out() << "ENDING: " << ending2.first << "\n";
+    out() << ending2.second << "\n";
+
+    int stars = starsFromStats(player);
+
+    out() << "ENDING RATING (Stars out of 5): " << stars << "/5\n";
+    if (stars == 5) {
+        out() << "Legendary Summer! You mastered balance, thrived socially, and left with strong bonds.\n";
+    } else if (stars == 4) {
+        out() << "Great Summer! You did well, with only minor struggles.\n";
+    } else if (stars == 3) {
+        out() << "Average Summer. You survived, but missed key opportunities.\n";
+    } else if (stars == 2) {
+        out() << "Rough Summer. You barely scraped by, and your stats suffered.\n";
+    } else {
+        out() << "Disaster Summer. You failed to balance life, relationships, or finances.\n";
+    }
+
+    // Game completed successfully: clear any existing save file.
+    SaveGame::clear(savePath);
+}
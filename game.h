@@ -0,0 +1,24 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include <string>
+
+#include "balance.h"
+#include "catalog.h"
+#include "task.h"
+
+// runGame()
+// Plays one game of SUMMER MAXXING with in()/out(): the intro, difficulty or save selection, the
+// eight weeks of scenarios and events, and the ending.
+// Input: content catalog, save file path (empty disables loading and saving), balance values (must
+// outlive the game), and a difficulty (1 = Easy, 2 = Medium, 3 = Hard) to start on without asking,
+// or 0 to let the player choose. Output: a Task that runs the game; it parks whenever it waits for input.
+Task<void> runGame(const Content::Catalog &catalog, std::string savePath, const Balance &balance = defaultBalance(),
+                   int difficulty = 0);
+
+// applyEffect()
+// Applies a choice's stat and affinity changes, scaling energy costs by the difficulty.
+// Input: player and relationships to update, the effect, and difficulty settings. Output: none.
+void applyEffect(Player &player, Relationships &rels, const Effect &effect, const DifficultySettings &diff);
+
+#endif // GAME_H
@@ -0,0 +1,226 @@
+// Golden-transcript regression tests: every case in the golden/ directory is an input script,
+// NAME.in, and the transcript it must produce, NAME.out. Each script is played through runGame()
+// in a seeded Session (saving off, pauses skipped, output captured), and the transcript is the
+// game's output with each answer echoed after the prompt it answered, as the terminal shows it.
+//
+// A script starts with any number of "#" comment lines saying what the case covers, then a line
+// "seed N"; every other line is one answer, submitted as typed. Answers left over when the game
+// ends are ignored; a game still waiting when the answers run out ends the transcript with
+// "[input ended]".
+//
+// A script whose seed line reads "seed N terminal" is played instead the way main() plays at the
+// terminal: runToEnd(runGame(...)) reading its answers from a stream, with saving to
+// golden_test.save in the current directory (removed before and after the case). Its transcript is
+// the game's output alone, since a terminal's echo is not part of it. A line "restart" ends one
+// run and starts the game again with the save file kept, so saving and loading can be tested; the
+// runs are separated by "[restart]" in the transcript. A run whose answers run out reads end of
+// input, as at a terminal after Ctrl-D.
+//
+// Build and run with `make test`. After a deliberate change to the game's text or rules, rerun
+// with --update to rewrite the transcripts, and review the diff before committing them.
+// Usage: ./golden_test [--update] [DIR]
+// Must run from the directory holding scenarios.txt / scenarios.pack.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catalog.h"
+#include "game.h"
+#include "output.h"
+#include "session.h"
+#include "util.h"
+
+namespace {
+
+// Save file used by terminal cases.
+const char *const kSaveFile = "golden_test.save";
+
+// Case
+// One test's seed and answers, and whether it is played as at the terminal.
+struct Case {
+    uint32_t seed = 0;
+    bool terminal = false;
+    std::vector<std::string> answers;
+};
+
+// readScript()
+// Input: path, script to fill, and error string. Output: false if the file is missing or has no seed line.
+bool readScript(const std::string &path, Case &script, std::string &error)
+{
+    std::ifstream file(path);
+    std::string line;
+    bool read = false;
+    while ((read = static_cast<bool>(std::getline(file, line))) && line.compare(0, 1, "#") == 0) continue;
+    if (!read || line.compare(0, 5, "seed ") != 0) {
+        error = path + ": expected \"seed N\" after the comments";
+        return false;
+    }
+    char *end = nullptr;
+    script.seed = static_cast<uint32_t>(std::strtoul(line.c_str() + 5, &end, 10));
+    script.terminal = std::string(end) == " terminal";
+    while (std::getline(file, line)) script.answers.push_back(line);
+    return true;
+}
+
+// play()
+// Plays a script and returns its transcript.
+// Input: catalog and script. Output: transcript.
+std::string play(const std::shared_ptr<const Content::Catalog> &catalog, const Case &script)
+{
+    Session session(catalog, [](const Content::Catalog &content) { return runGame(content, std::string()); });
+    session.seed(script.seed);
+    session.start();
+    std::string transcript = session.takeOutput();
+    for (const std::string &answer : script.answers) {
+        if (session.isFinished()) break;
+        transcript += answer;
+        transcript += '\n';
+        session.submit(answer);
+        transcript += session.takeOutput();
+    }
+    if (!session.isFinished()) {
+        if (!transcript.empty() && transcript.back() != '\n') transcript += '\n';
+        transcript += "[input ended]\n";
+    }
+    return transcript;
+}
+
+// playTerminal()
+// Plays a terminal script, one run per "restart"-separated part, and returns its transcript.
+// Input: catalog and script. Output: transcript.
+std::string playTerminal(const std::shared_ptr<const Content::Catalog> &catalog, const Case &script)
+{
+    std::filesystem::remove(kSaveFile);
+    GameRandom random;
+    random.seed(script.seed);
+    GameRandom *previousRandom = setGameRandom(&random);
+    bool previousDelays = setDelays(false);
+    CaptureSink capture;
+    OutputSink *previousSink = setOutput(&capture);
+    std::string transcript;
+    size_t next = 0;
+    while (true) {
+        std::string answers;
+        for (; next < script.answers.size() && script.answers[next] != "restart"; ++next) {
+            answers += script.answers[next] + "\n";
+        }
+        std::istringstream input(answers);
+        setInput(&input);
+        runToEnd(runGame(*catalog, kSaveFile));
+        out().flush();
+        transcript += capture.take();
+        if (next++ >= script.answers.size()) break;
+        transcript += "[restart]\n";
+    }
+    setInput(nullptr);
+    setOutput(previousSink);
+    setDelays(previousDelays);
+    setGameRandom(previousRandom);
+    std::filesystem::remove(kSaveFile);
+    return transcript;
+}
+
+// readFile()
+// Input: path and string to fill. Output: false if the file could not be read.
+bool readFile(const std::string &path, std::string &text)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    text = contents.str();
+    return true;
+}
+
+// firstDifference()
+// Describes the first line where two transcripts differ.
+// Input: expected and actual transcripts. Output: line number with both versions of the line.
+std::string firstDifference(const std::string &expected, const std::string &actual)
+{
+    std::istringstream a(expected);
+    std::istringstream b(actual);
+    std::string left;
+    std::string right;
+    for (int line = 1;; ++line) {
+        bool moreLeft = static_cast<bool>(std::getline(a, left));
+        bool moreRight = static_cast<bool>(std::getline(b, right));
+        if (!moreLeft && !moreRight) return "transcripts differ only in line endings";
+        if (!moreLeft || !moreRight || left != right) {
+            return "line " + std::to_string(line) + ":\n    expected: " + (moreLeft ? left : "(end of transcript)") +
+                   "\n    actual:   " + (moreRight ? right : "(end of transcript)");
+        }
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    bool update = false;
+    std::string dir = "golden";
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--update") {
+            update = true;
+        } else {
+            dir = arg;
+        }
+    }
+
+    std::string error;
+    std::shared_ptr<const Content::Catalog> catalog = Content::load("scenarios.txt", "scenarios.pack", error);
+    if (!catalog) {
+        std::fprintf(stderr, "Could not load content: %s\n", error.c_str());
+        return 1;
+    }
+    std::vector<std::string> cases;
+    std::error_code failed;
+    for (const auto &entry : std::filesystem::directory_iterator(dir, failed)) {
+        if (entry.path().extension() == ".in") cases.push_back(entry.path().stem().string());
+    }
+    if (failed || cases.empty()) {
+        std::fprintf(stderr, "No cases in %s\n", dir.c_str());
+        return 1;
+    }
+    std::sort(cases.begin(), cases.end());
+
+    auto begin = std::chrono::steady_clock::now();
+    int failures = 0;
+    for (const std::string &name : cases) {
+        std::string base = dir + "/" + name;
+        Case script;
+        if (!readScript(base + ".in", script, error)) {
+            std::printf("FAIL %s: %s\n", name.c_str(), error.c_str());
+            ++failures;
+            continue;
+        }
+        std::string actual = script.terminal ? playTerminal(catalog, script) : play(catalog, script);
+        if (update) {
+            std::ofstream(base + ".out", std::ios::binary) << actual;
+            continue;
+        }
+        std::string expected;
+        if (!readFile(base + ".out", expected)) {
+            std::printf("FAIL %s: no %s.out (run with --update to record it)\n", name.c_str(), name.c_str());
+            ++failures;
+        } else if (actual != expected) {
+            std::printf("FAIL %s: %s\n", name.c_str(), firstDifference(expected, actual).c_str());
+            ++failures;
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    if (update) {
+        std::printf("Recorded %zu transcripts in %.3f s\n", cases.size(), seconds);
+        return 0;
+    }
+    std::printf("%zu cases, %d failed, %.3f s\n", cases.size(), failures, seconds);
+    return failures > 0 ? 1 : 0;
+}
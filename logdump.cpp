@@ -0,0 +1,153 @@
+// logdump: decodes a decision log written with --log (see logformat.h) to CSV on standard output.
+// Usage: logdump LOGFILE > log.csv
+//
+// One row per record, in file order; Name records are folded into the event column. For choice
+// and event rows the six stat columns are the changes the record caused; for end rows they are
+// the final stats. Columns that do not apply to a record are left empty.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "logformat.h"
+
+namespace {
+
+// Reader
+// Walks the log's bytes; a read past the end marks the reader as failed.
+struct Reader {
+    const std::vector<unsigned char> &bytes;
+    size_t pos = 0;
+    bool failed = false;
+
+    uint64_t get()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= bytes.size()) {
+                failed = true;
+                return 0;
+            }
+            unsigned char byte = bytes[pos++];
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) return value;
+        }
+        failed = true;
+        return value;
+    }
+
+    int64_t getSigned()
+    {
+        uint64_t value = get();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+};
+
+// csvField()
+// Quotes a text field when it holds a comma, quote, or line break.
+std::string csvField(const std::string &text)
+{
+    if (text.find_first_of(",\"\n\r") == std::string::npos) return text;
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"') quoted += '"';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+// printStats()
+// Prints the six stat columns.
+void printStats(Reader &reader)
+{
+    for (int i = 0; i < 6; ++i) std::printf(",%lld", static_cast<long long>(reader.getSigned()));
+    std::printf("\n");
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    if (argc != 2) {
+        std::cerr << "Usage: " << argv[0] << " LOGFILE\n";
+        return 1;
+    }
+    std::ifstream file(argv[1], std::ios::binary);
+    if (!file) {
+        std::cerr << "Cannot open " << argv[1] << "\n";
+        return 1;
+    }
+    std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (bytes.size() < sizeof(EventLog::kMagic) ||
+        !std::equal(std::begin(EventLog::kMagic), std::end(EventLog::kMagic), bytes.begin(),
+                    [](char a, unsigned char b) { return static_cast<unsigned char>(a) == b; })) {
+        std::cerr << argv[1] << " is not a decision log\n";
+        return 1;
+    }
+
+    Reader reader{bytes, sizeof(EventLog::kMagic)};
+    std::unordered_map<uint64_t, std::string> names;
+    std::printf("record,game,week,slot,choice,available,event,seed,game_over,stars,cause,"
+                "energy,health,social,academic,fitness,money\n");
+    while (reader.pos < bytes.size() && !reader.failed) {
+        unsigned char type = bytes[reader.pos++];
+        switch (type) {
+        case EventLog::Start: {
+            uint64_t game = reader.get();
+            uint64_t seed = reader.get();
+            std::printf("start,%llu,,,,,,%llu,,,,,,,,,\n", static_cast<unsigned long long>(game),
+                        static_cast<unsigned long long>(seed));
+            break;
+        }
+        case EventLog::Choice: {
+            unsigned long long fields[5];
+            for (unsigned long long &field : fields) field = reader.get();
+            std::printf("choice,%llu,%llu,%llu,%llu,%llu,,,,,", fields[0], fields[1], fields[2], fields[3], fields[4]);
+            printStats(reader);
+            break;
+        }
+        case EventLog::Event: {
+            unsigned long long game = reader.get();
+            unsigned long long week = reader.get();
+            uint64_t id = reader.get();
+            auto name = names.find(id);
+            std::printf("event,%llu,%llu,,,,%s,,,,", game, week,
+                        csvField(name != names.end() ? name->second : std::to_string(id)).c_str());
+            printStats(reader);
+            break;
+        }
+        case EventLog::Name: {
+            uint64_t id = reader.get();
+            uint64_t length = reader.get();
+            if (length > bytes.size() - reader.pos) {
+                reader.failed = true;
+                break;
+            }
+            names[id].assign(reinterpret_cast<const char *>(&bytes[reader.pos]), static_cast<size_t>(length));
+            reader.pos += static_cast<size_t>(length);
+            break;
+        }
+        case EventLog::End: {
+            unsigned long long fields[5];
+            for (unsigned long long &field : fields) field = reader.get();
+            std::printf("end,%llu,%llu,,,,,,%llu,%llu,%llu", fields[0], fields[2], fields[1] & 1, fields[3], fields[4]);
+            printStats(reader);
+            break;
+        }
+        default:
+            reader.failed = true;
+            break;
+        }
+    }
+    if (reader.failed) {
+        std::cerr << "Log is damaged or cut short near byte " << reader.pos << "\n";
+        return 1;
+    }
+    return 0;
+}
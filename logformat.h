@@ -0,0 +1,28 @@
+#ifndef LOGFORMAT_H
+#define LOGFORMAT_H
+
+#include <cstdint>
+
+// Binary decision log layout (written with --log, read by logdump).
+//
+// The file starts with the 8-byte magic "SMLOG\1\0\0" and continues with records. Each record
+// is a type byte followed by unsigned LEB128 varints; signed values are zigzag-encoded first.
+// Stats are always in the order energy, health, social, academic, fitness, money.
+//
+//   1 Start   game, seed (0 if unseeded)
+//   2 Choice  game, week, slot, choice (index in the scenario's full list), choices unlocked,
+//             six stat changes (signed) from the choice, its special effect, and the critical rules
+//   3 Event   game, week, name id, six stat changes (signed)
+//   4 Name    name id, length, bytes; appears before the first event with that id from the same thread
+//   5 End     game, flags (1 = game over), week, stars, cause (GameOverCause), six final stats (signed)
+//
+// Records from different games and threads are interleaved; each carries its game's number.
+namespace EventLog {
+
+enum RecordType : uint8_t { Start = 1, Choice = 2, Event = 3, Name = 4, End = 5 };
+
+constexpr char kMagic[8] = {'S', 'M', 'L', 'O', 'G', 1, 0, 0};
+
+} // namespace EventLog
+
+#endif // LOGFORMAT_H
@@ -0,0 +1,237 @@
+// Microbenchmarks for the engine primitives the game loop and the simulators call most: stat
+// updates, affinity changes, applying a choice, building a week, finding a scenario, saving and
+// loading, and the random draws. Each one reports the time and heap allocations per operation, so a
+// change that slows the core down or makes it allocate shows up before it reaches --simulate.
+//
+// Build and run with `make bench` (objects are compiled with -O2, separately from the game's).
+// Usage: ./microbench [name filter] [seconds per benchmark]
+// Must run from the directory holding scenarios.txt / scenarios.pack.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "allochook.h"
+#include "balance.h"
+#include "catalog.h"
+#include "game.h"
+#include "player.h"
+#include "relationships.h"
+#include "savegame.h"
+#include "util.h"
+
+// Heap allocations made by this process, counted by the replaced operator new (allochook.cpp).
+static std::atomic<unsigned long long> allocations{0};
+static std::atomic<unsigned long long> allocatedBytes{0};
+
+void AllocHook::counted(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+namespace {
+
+// keep()
+// Makes the compiler treat a value as used, so a benchmarked call is not optimized away.
+template <typename T>
+inline void keep(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Benchmark
+// One named operation; body runs it the given number of times.
+struct Benchmark {
+    const char *name;
+    std::function<void(long long iterations)> body;
+};
+
+// Measurement
+struct Measurement {
+    double nsPerOp = 0.0;
+    double allocsPerOp = 0.0;
+    double bytesPerOp = 0.0;
+};
+
+// run()
+// Grows the iteration count until one pass takes a tenth of the budget, then times three passes of
+// the budget's length and keeps the fastest. Allocations are from the last pass.
+// Input: benchmark and seconds per pass. Output: per-operation cost.
+Measurement run(const Benchmark &benchmark, double seconds)
+{
+    using Clock = std::chrono::steady_clock;
+    auto timePass = [&](long long n) {
+        auto begin = Clock::now();
+        benchmark.body(n);
+        return std::chrono::duration<double>(Clock::now() - begin).count();
+    };
+
+    long long n = 1;
+    double elapsed = timePass(n);
+    while (elapsed < seconds / 10 && n < (1LL << 40)) {
+        n *= elapsed > 0 ? std::clamp(static_cast<long long>(seconds / 10 / elapsed * 1.5), 2LL, 100LL) : 100;
+        elapsed = timePass(n);
+    }
+    n = std::max(1LL, static_cast<long long>(static_cast<double>(n) * seconds / std::max(elapsed, 1e-9)));
+
+    Measurement best;
+    best.nsPerOp = 1e300;
+    for (int pass = 0; pass < 3; ++pass) {
+        unsigned long long allocsBefore = allocations.load();
+        unsigned long long bytesBefore = allocatedBytes.load();
+        double time = timePass(n);
+        best.nsPerOp = std::min(best.nsPerOp, time * 1e9 / static_cast<double>(n));
+        best.allocsPerOp = static_cast<double>(allocations.load() - allocsBefore) / static_cast<double>(n);
+        best.bytesPerOp = static_cast<double>(allocatedBytes.load() - bytesBefore) / static_cast<double>(n);
+    }
+    return best;
+}
+
+// findEffect()
+// Returns the first choice effect in the catalog that changes an affinity, so applyEffect() is
+// measured on its full path. Input: catalog. Output: the effect (a copy).
+Effect findEffect(const Content::Catalog &catalog)
+{
+    for (int week = 1; week <= kSummerWeeks; ++week) {
+        for (const Scenario &scenario : catalog.loadWeek(week)) {
+            for (const Choice &choice : scenario.choices) {
+                if (!choice.effect.affinityDeltas.empty()) return choice.effect;
+            }
+        }
+    }
+    Effect effect;
+    effect.energy = -10;
+    effect.social = 5;
+    effect.affinityDeltas["Alex"] = 5;
+    return effect;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    std::string filter = argc > 1 ? argv[1] : "";
+    double seconds = argc > 2 ? std::atof(argv[2]) : 0.2;
+    if (seconds <= 0) seconds = 0.2;
+
+    std::string error;
+    std::shared_ptr<const Content::Catalog> catalog = Content::load("scenarios.txt", "scenarios.pack", error);
+    if (!catalog) {
+        std::fprintf(stderr, "Could not load content: %s\n", error.c_str());
+        return 1;
+    }
+    const DifficultySettings &medium = defaultBalance().presets[2].settings;
+    const Effect effect = findEffect(*catalog);
+    const std::pmr::vector<Scenario> week3 = catalog->loadWeek(3);
+    const std::string savePath = (std::filesystem::temp_directory_path() / "summer_maxxing_bench.sav").string();
+    std::srand(1);
+    rng().seed(1);
+
+    std::vector<Benchmark> benchmarks = {
+        {"Player::adjustEnergy", [](long long n) {
+             Player p;
+             for (long long i = 0; i < n; ++i) p.adjustEnergy((i & 1) ? 7 : -7);
+             keep(p);
+         }},
+        {"Player::adjust* (all six)", [](long long n) {
+             Player p;
+             for (long long i = 0; i < n; ++i) {
+                 int d = (i & 1) ? 3 : -3;
+                 p.adjustEnergy(d);
+                 p.adjustHealth(d);
+                 p.adjustSocial(d);
+                 p.adjustAcademic(d);
+                 p.adjustFitness(d);
+                 p.adjustMoney(d);
+             }
+             keep(p);
+         }},
+        {"Player::clampStats", [](long long n) {
+             Player p;
+             for (long long i = 0; i < n; ++i) {
+                 p.energy += (i & 1) ? 150 : -150;
+                 p.clampStats();
+             }
+             keep(p);
+         }},
+        {"Relationships::interactWith (last NPC)", [](long long n) {
+             Relationships rels;
+             for (long long i = 0; i < n; ++i) rels.interactWith("Jordan", (i & 1) ? 2 : -2);
+             keep(rels.npcs.front().affinity);
+         }},
+        {"Relationships copy", [](long long n) {
+             Relationships rels;
+             for (long long i = 0; i < n; ++i) {
+                 Relationships snapshot = rels;
+                 keep(snapshot.npcs.data());
+             }
+         }},
+        {"applyEffect", [&](long long n) {
+             Player p;
+             Relationships rels;
+             for (long long i = 0; i < n; ++i) {
+                 applyEffect(p, rels, effect, medium);
+                 if ((i & 7) == 7) p = Player();
+             }
+             keep(p);
+         }},
+        {"Catalog::loadWeek", [&](long long n) {
+             for (long long i = 0; i < n; ++i) {
+                 std::pmr::vector<Scenario> scenarios = catalog->loadWeek(static_cast<int>(i % kSummerWeeks) + 1);
+                 keep(scenarios.data());
+             }
+         }},
+        {"scenario lookup", [&](long long n) {
+             for (long long i = 0; i < n; ++i) {
+                 int slot = static_cast<int>(i & 3) + 1;
+                 auto it = std::find_if(week3.begin(), week3.end(),
+                                        [&](const Scenario &sc) { return sc.week == 3 && sc.index == slot; });
+                 keep(it);
+             }
+         }},
+        {"SaveGame::save", [&](long long n) {
+             Player p;
+             for (long long i = 0; i < n; ++i) keep(SaveGame::save(p, 3, 2, savePath));
+         }},
+        {"SaveGame::load", [&](long long n) {
+             Player p;
+             int week = 0;
+             int scenario = 0;
+             SaveGame::save(p, 3, 2, savePath);
+             for (long long i = 0; i < n; ++i) keep(SaveGame::load(p, week, scenario, savePath));
+             keep(p);
+         }},
+        {"roll", [](long long n) {
+             int hits = 0;
+             for (long long i = 0; i < n; ++i) hits += roll(0.3);
+             keep(hits);
+         }},
+        {"chance", [](long long n) {
+             int hits = 0;
+             for (long long i = 0; i < n; ++i) hits += chance(0.3);
+             keep(hits);
+         }},
+        {"randomUnit", [](long long n) {
+             double sum = 0.0;
+             for (long long i = 0; i < n; ++i) sum += randomUnit();
+             keep(sum);
+         }},
+    };
+
+    std::printf("%-40s %12s %12s %12s\n", "benchmark", "ns/op", "allocs/op", "bytes/op");
+    for (const Benchmark &benchmark : benchmarks) {
+        if (!filter.empty() && std::string(benchmark.name).find(filter) == std::string::npos) continue;
+        Measurement m = run(benchmark, seconds);
+        std::printf("%-40s %12.1f %12.2f %12.1f\n", benchmark.name, m.nsPerOp, m.allocsPerOp, m.bytesPerOp);
+        std::fflush(stdout);
+    }
+    SaveGame::clear(savePath);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "output.h"
+#include <cerrno>
+#include <cstdio>
+#include <unistd.h>
+
+namespace {
+
+// The process-wide terminal; sessions that print elsewhere install their own sink per thread.
+TerminalSink &terminal()
+{
+    static TerminalSink sink;
+    return sink;
+}
+
+thread_local OutputSink *current = nullptr;
+
+} // anonymous namespace
+
+// OutputSink::operator<<(double)
+// Matches what std::cout prints for a double with default formatting.
+OutputSink &OutputSink::operator<<(double value)
+{
+    if (active) {
+        char digits[32];
+        int n = std::snprintf(digits, sizeof(digits), "%g", value);
+        frame.append(digits, n > 0 ? static_cast<size_t>(n) : 0);
+    }
+    return *this;
+}
+
+// OutputSink::flush()
+// Hands the frame to deliver() and starts a new one.
+// Input: none. Output: none.
+void OutputSink::flush()
+{
+    if (frame.empty()) return;
+    deliver(frame);
+    frame.clear();
+}
+
+TerminalSink::~TerminalSink()
+{
+    flush();
+}
+
+// TerminalSink::deliver()
+// Writes the frame to stdout, retrying on short writes and signals.
+void TerminalSink::deliver(std::string_view text)
+{
+    const char *p = text.data();
+    size_t left = text.size();
+    while (left > 0) {
+        ssize_t n = ::write(STDOUT_FILENO, p, left);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return;
+        p += n;
+        left -= static_cast<size_t>(n);
+    }
+}
+
+BufferedSink::~BufferedSink()
+{
+    flush();
+}
+
+// BufferedSink::deliver()
+// Writes the frame to the stream in one call.
+void BufferedSink::deliver(std::string_view text)
+{
+    stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+    stream.flush();
+}
+
+// out()
+// Returns the current thread's sink, defaulting to the terminal.
+OutputSink &out()
+{
+    return current ? *current : terminal();
+}
+
+// setOutput()
+// Flushes the old sink so its text is not left behind, then switches.
+OutputSink *setOutput(OutputSink *sink)
+{
+    OutputSink *previous = &out();
+    previous->flush();
+    current = sink;
+    return previous;
+}
@@ -0,0 +1,148 @@
+#ifndef OUTPUT_H
+#define OUTPUT_H
+
+#include <charconv>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// OutputSink
+// Destination for everything the game prints. Text is appended to a frame buffer with the usual
+// "<<" syntax and handed to the sink in one piece when the frame ends: flush() is called before
+// every input read and every dramatic pause, so the player sees exactly what the old per-line
+// std::cout output showed at each of those points. A disabled sink (NullSink) skips formatting
+// entirely, so headless runs pay only a branch per "<<".
+class OutputSink {
+public:
+    virtual ~OutputSink() = default;
+    OutputSink(const OutputSink &) = delete;
+    OutputSink &operator=(const OutputSink &) = delete;
+
+    // enabled()
+    // Reports whether text is kept. Callers can skip building expensive text when it is not.
+    bool enabled() const { return active; }
+
+    OutputSink &operator<<(std::string_view text)
+    {
+        if (active) frame.append(text);
+        return *this;
+    }
+
+    OutputSink &operator<<(const char *text) { return *this << std::string_view(text); }
+
+    OutputSink &operator<<(const std::string &text) { return *this << std::string_view(text); }
+
+    OutputSink &operator<<(char c)
+    {
+        if (active) frame.push_back(c);
+        return *this;
+    }
+
+    template <typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
+    OutputSink &operator<<(T value)
+    {
+        if (active) {
+            char digits[24];
+            std::to_chars_result r = std::is_signed_v<T>
+                ? std::to_chars(digits, digits + sizeof(digits), static_cast<long long>(value))
+                : std::to_chars(digits, digits + sizeof(digits), static_cast<unsigned long long>(value));
+            frame.append(digits, r.ptr);
+        }
+        return *this;
+    }
+
+    // Doubles are formatted like std::ostream's default (%g, 6 significant digits).
+    OutputSink &operator<<(double value);
+
+    // flush()
+    // Ends the current frame and delivers it to the destination in a single write.
+    // Input: none. Output: none.
+    void flush();
+
+protected:
+    explicit OutputSink(bool active_ = true) : active(active_) {}
+
+    // deliver()
+    // Sends one finished frame to the destination. Never called with an empty frame.
+    virtual void deliver(std::string_view text) = 0;
+
+private:
+    std::string frame;
+    bool active;
+};
+
+// TerminalSink
+// Writes each frame to standard output with one write() call.
+class TerminalSink : public OutputSink {
+public:
+    TerminalSink() = default;
+    ~TerminalSink() override;
+
+protected:
+    void deliver(std::string_view text) override;
+};
+
+// BufferedSink
+// Writes each frame to a std::ostream (a file, a socket stream, a log) and flushes the stream.
+class BufferedSink : public OutputSink {
+public:
+    explicit BufferedSink(std::ostream &stream_) : stream(stream_) {}
+    ~BufferedSink() override;
+
+protected:
+    void deliver(std::string_view text) override;
+
+private:
+    std::ostream &stream;
+};
+
+// NullSink
+// Discards everything without formatting it; for bots, simulations, and benchmarks.
+class NullSink : public OutputSink {
+public:
+    NullSink() : OutputSink(false) {}
+
+protected:
+    void deliver(std::string_view) override {}
+};
+
+// CaptureSink
+// Keeps all output in memory, e.g. to compare a run against a recorded transcript.
+class CaptureSink : public OutputSink {
+public:
+    // text()
+    // Returns everything flushed so far. Input: none. Output: captured text.
+    const std::string &text() const { return captured; }
+
+    // clear()
+    // Forgets the captured text. Input: none. Output: none.
+    void clear() { captured.clear(); }
+
+    // take()
+    // Returns the captured text and clears it. Input: none. Output: captured text.
+    std::string take()
+    {
+        std::string text;
+        text.swap(captured);
+        return text;
+    }
+
+protected:
+    void deliver(std::string_view text) override { captured.append(text); }
+
+private:
+    std::string captured;
+};
+
+// out()
+// Returns the sink the current thread prints to (the terminal unless setOutput() changed it).
+// Input: none. Output: reference to the active sink.
+OutputSink &out();
+
+// setOutput()
+// Redirects the current thread's output. The previous sink is flushed first.
+// Input: sink to use, or nullptr for the terminal. Output: the sink that was active before.
+OutputSink *setOutput(OutputSink *sink);
+
+#endif // OUTPUT_H
@@ -0,0 +1,87 @@
+#ifndef PACK_H
+#define PACK_H
+
+#include <cstdint>
+
+#include "script.h"
+
+// Binary content pack layout ("scenarios.pack").
+//
+// A pack is the compiled form of scenarios.txt, written by the packc tool and memory-mapped by
+// the game. Every section is a flat array of fixed-size records placed at an 8-byte aligned
+// offset, so the loader only checks bounds and then reads the records in place:
+//
+//   Header
+//   WeekRecord[weekCount]           weeks in ascending order
+//   ScenarioRecord[scenarioCount]   scenarios grouped by week, in file order within a week
+//   ChoiceRecord[choiceCount]       choices, grouped by scenario
+//   AffinityRecord[affinityCount]   "affinity" effect entries, grouped by choice
+//   Script::Instr[codeCount]        bytecode shared by every script, condition, and event
+//   Script::EventRef[eventCount]    named events
+//   Script::StringRef[stringCount]  offsets into the text section
+//   char[textSize]                  all strings back to back (not NUL-terminated)
+//
+// The text section is ordered by the first week that uses each string, and scripts are compiled
+// in file order, so each week's text and bytecode sit in one contiguous byte range. The game
+// uses those ranges to page a week in when it starts and drop it once the week is over.
+//
+// Strings are referenced by index into the string table. Numbers are stored in host byte order;
+// packs are build artifacts, not an interchange format.
+namespace Pack {
+
+const char kMagic[8] = {'S', 'M', 'X', 'P', 'A', 'C', 'K', '\0'};
+const uint32_t kVersion = 4;
+const uint32_t kNone = 0xFFFFFFFFu; // choice without a script or condition
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t instrSize; // sizeof(Script::Instr) when written
+    uint32_t weekCount, weekOffset;
+    uint32_t scenarioCount, scenarioOffset;
+    uint32_t choiceCount, choiceOffset;
+    uint32_t affinityCount, affinityOffset;
+    uint32_t codeCount, codeOffset;
+    uint32_t eventCount, eventOffset;
+    uint32_t stringCount, stringOffset;
+    uint32_t textSize, textOffset;
+};
+
+struct WeekRecord {
+    int32_t week;
+    uint32_t firstScenario;
+    uint32_t scenarioCount;
+    uint32_t textBegin, textEnd; // byte range in the text section first used by this week
+    uint32_t codeBegin, codeEnd; // instruction range of this week's scripts
+};
+
+struct ScenarioRecord {
+    int32_t week;
+    int32_t index;
+    uint32_t location; // string index
+    uint32_t prompt;   // string index
+    uint32_t firstChoice;
+    uint32_t choiceCount;
+};
+
+struct ChoiceRecord {
+    uint32_t title;      // string index
+    uint32_t detail;     // string index
+    uint32_t lockReason; // string index
+    int32_t energy, health, social, academic, fitness, money;
+    uint32_t firstAffinity;
+    uint32_t affinityCount;
+    uint32_t scriptPc;   // kNone when the choice has no script
+    uint32_t scriptLocals;
+    uint32_t whenPc;     // kNone when the choice is always available
+    uint32_t whenLocals;
+};
+
+struct AffinityRecord {
+    uint32_t npc; // string index
+    int32_t delta;
+};
+
+} // namespace Pack
+
+#endif // PACK_H
@@ -0,0 +1,44 @@
+#include "content.h"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// packc
+// Offline content compiler: compiles scenarios.txt into the binary content pack the game maps
+// at startup. The pack is written to a temporary file and renamed into place, so running games
+// that still map the previous pack are unaffected.
+// Usage: packc <content.txt> <content.pack>
+int main(int argc, char **argv)
+{
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <content.txt> <content.pack>\n";
+        return 2;
+    }
+    const std::string source = argv[1];
+    const std::string target = argv[2];
+
+    std::vector<char> pack;
+    std::string error;
+    if (!Content::compileFile(source, pack, error)) {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    const std::string temp = target + ".tmp";
+    {
+        std::ofstream ofs(temp, std::ios::binary | std::ios::trunc);
+        if (!ofs || !ofs.write(pack.data(), static_cast<std::streamsize>(pack.size()))) {
+            std::cerr << temp << ": could not write content pack\n";
+            return 1;
+        }
+    }
+    if (std::rename(temp.c_str(), target.c_str()) != 0) {
+        std::cerr << target << ": could not replace content pack\n";
+        std::remove(temp.c_str());
+        return 1;
+    }
+    std::cout << target << ": " << pack.size() << " bytes\n";
+    return 0;
+}
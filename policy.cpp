@@ -0,0 +1,186 @@
+#include "policy.h"
+#include "relationships.h"
+#include <algorithm>
+#include <climits>
+#include <vector>
+
+namespace {
+
+enum Stat { Energy, Health, Social, Academic, Fitness, Money, StatCount };
+
+const char *const kStatNames[StatCount] = {"energy", "health", "social", "academic", "fitness", "money"};
+
+// Money moves in dollars, the other stats in points out of 100; this puts money on the same scale.
+const int kDollarsPerPoint = 25;
+
+// statDelta()
+// Returns a choice's listed change to one stat.
+int statDelta(const Effect &effect, int stat)
+{
+    switch (stat) {
+    case Energy: return effect.energy;
+    case Health: return effect.health;
+    case Social: return effect.social;
+    case Academic: return effect.academic;
+    case Fitness: return effect.fitness;
+    default: return effect.money;
+    }
+}
+
+// statValue()
+// Returns the player's current value of one stat.
+int statValue(const Player &player, int stat)
+{
+    switch (stat) {
+    case Energy: return player.energy;
+    case Health: return player.health;
+    case Social: return player.social;
+    case Academic: return player.academic;
+    case Fitness: return player.fitness;
+    default: return player.money;
+    }
+}
+
+// pickBest()
+// Returns the menu position with the highest score, breaking ties at random.
+// Input: decision, scoring function, generator. Output: menu position.
+template <typename Score>
+int pickBest(const Decision &decision, Score score, std::mt19937 &random)
+{
+    long long best = LLONG_MIN;
+    int chosen = 0;
+    int ties = 0;
+    for (int i = 0; i < decision.count; ++i) {
+        long long value = score(decision.option(i));
+        if (value > best) {
+            best = value;
+            chosen = i;
+            ties = 1;
+        } else if (value == best && std::uniform_int_distribution<int>(0, ties++)(random) == 0) {
+            chosen = i; // reservoir sampling keeps each tied choice equally likely
+        }
+    }
+    return chosen;
+}
+
+class RandomPolicy : public Policy {
+public:
+    int choose(const Decision &decision, std::mt19937 &random) const override
+    {
+        return std::uniform_int_distribution<int>(0, decision.count - 1)(random);
+    }
+
+    std::string name() const override { return "random"; }
+};
+
+class GreedyPolicy : public Policy {
+public:
+    explicit GreedyPolicy(int stat_) : stat(stat_) {}
+
+    int choose(const Decision &decision, std::mt19937 &random) const override
+    {
+        return pickBest(decision, [this](const Choice &c) { return statDelta(c.effect, stat); }, random);
+    }
+
+    std::string name() const override { return std::string("greedy:") + kStatNames[stat]; }
+
+private:
+    int stat;
+};
+
+class BalancedPolicy : public Policy {
+public:
+    // Scores a choice by the weakest stat it would leave (money in points), then by the total.
+    int choose(const Decision &decision, std::mt19937 &random) const override
+    {
+        const Player &player = *decision.player;
+        return pickBest(decision, [&player](const Choice &c) {
+            long long weakest = LLONG_MAX;
+            long long total = 0;
+            for (int stat = 0; stat < StatCount; ++stat) {
+                long long after = statValue(player, stat) + statDelta(c.effect, stat);
+                if (stat == Money) after /= kDollarsPerPoint;
+                weakest = std::min(weakest, after);
+                total += after;
+            }
+            return weakest * 1000 + total;
+        }, random);
+    }
+
+    std::string name() const override { return "balanced"; }
+};
+
+// An effect's affinity key goes to the first NPC whose name contains it, as in
+// Relationships::interactWith(); only keys that land on the chosen NPC count.
+class AffinityPolicy : public Policy {
+public:
+    AffinityPolicy(std::string spec_, std::vector<std::string> roster_, size_t target_)
+        : spec(std::move(spec_)), roster(std::move(roster_)), target(target_)
+    {
+    }
+
+    int choose(const Decision &decision, std::mt19937 &random) const override
+    {
+        return pickBest(decision, [this](const Choice &c) {
+            long long gain = 0;
+            for (const auto &entry : c.effect.affinityDeltas) {
+                auto npc = std::find_if(roster.begin(), roster.end(), [&entry](const std::string &name) {
+                    return name.find(entry.first) != std::string::npos;
+                });
+                if (npc != roster.end() && static_cast<size_t>(npc - roster.begin()) == target) gain += entry.second;
+            }
+            return gain;
+        }, random);
+    }
+
+    std::string name() const override { return "affinity:" + spec; }
+
+private:
+    std::string spec;
+    std::vector<std::string> roster; // the starting NPCs' full names
+    size_t target;                   // index of the NPC this bot courts
+};
+
+// makeAffinityPolicy()
+// Resolves NAME to exactly one of the starting NPCs.
+// Input: name fragment and error string. Output: the policy, or null with an error.
+std::unique_ptr<Policy> makeAffinityPolicy(std::string_view name, std::string &error)
+{
+    Relationships starting;
+    std::vector<std::string> roster;
+    std::vector<size_t> matches;
+    for (const NPC &npc : starting.npcs) {
+        if (npc.name.find(name) != std::string::npos) matches.push_back(roster.size());
+        roster.emplace_back(npc.name);
+    }
+    if (matches.size() == 1) return std::unique_ptr<Policy>(new AffinityPolicy(std::string(name), roster, matches[0]));
+    std::string known;
+    for (const std::string &npc : roster) known += (known.empty() ? "" : ", ") + npc;
+    error = "affinity:" + std::string(name) + (matches.empty() ? " matches no NPC" : " matches more than one NPC") +
+            " (" + known + ")";
+    return nullptr;
+}
+
+} // anonymous namespace
+
+// makePolicy()
+// Splits "kind:argument" and checks the argument.
+std::unique_ptr<Policy> makePolicy(std::string_view spec, std::string &error)
+{
+    size_t colon = spec.find(':');
+    std::string_view kind = spec.substr(0, colon);
+    std::string_view arg = colon == std::string_view::npos ? std::string_view() : spec.substr(colon + 1);
+
+    if (kind == "random" && arg.empty()) return std::unique_ptr<Policy>(new RandomPolicy());
+    if (kind == "balanced" && arg.empty()) return std::unique_ptr<Policy>(new BalancedPolicy());
+    if (kind == "greedy") {
+        for (int stat = 0; stat < StatCount; ++stat) {
+            if (arg == kStatNames[stat]) return std::unique_ptr<Policy>(new GreedyPolicy(stat));
+        }
+        error = "greedy needs a stat: energy, health, social, academic, fitness, or money";
+        return nullptr;
+    }
+    if (kind == "affinity" && !arg.empty()) return makeAffinityPolicy(arg, error);
+    error = "unknown policy '" + std::string(spec) + "' (random, greedy:STAT, balanced, affinity:NAME)";
+    return nullptr;
+}
@@ -0,0 +1,40 @@
+#ifndef POLICY_H
+#define POLICY_H
+
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "scenario.h"
+
+// Policy
+// A bot that plays scenario choices for automated playtesting. It sees the unlocked choices and
+// the game state at each scenario prompt (a Decision) and picks one by looking at each choice's
+// listed effect; special scripts are not predicted. Policies keep no state between calls, so one
+// policy can play many games on many threads at once.
+class Policy {
+public:
+    virtual ~Policy() = default;
+
+    // choose()
+    // Picks one of the unlocked choices.
+    // Input: the decision and a generator for tie-breaks. Output: menu position in [0, decision.count).
+    virtual int choose(const Decision &decision, std::mt19937 &random) const = 0;
+
+    // name()
+    // Returns the spec that creates this policy, for reports.
+    virtual std::string name() const = 0;
+};
+
+// makePolicy()
+// Builds a built-in policy from a spec:
+//   random            any unlocked choice
+//   greedy:STAT       the choice that raises STAT most (energy, health, social, academic, fitness, money)
+//   balanced          the choice that leaves the weakest stat as high as possible
+//   affinity:NAME     the choice that raises affinity with NAME most; NAME must be part of exactly
+//                     one starting NPC's name (e.g. Alex or "Gym Crush")
+// Input: spec and a string for the error message. Output: the policy, or null with an error.
+std::unique_ptr<Policy> makePolicy(std::string_view spec, std::string &error);
+
+#endif // POLICY_H
@@ -0,0 +1,243 @@
+#include "profile.h"
+#include "allochook.h"
+
+#ifdef SUMMER_PROFILE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <atomic>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILE_TSC 1
+#endif
+
+namespace Profile {
+
+namespace {
+
+const char *const kPhaseNames[PhaseCount] = {
+    "sessionSetup", "schedule", "turn", "display", "snapshot", "loadWeek", "scenarioLookup", "availabilityCheck", "applyEffect", "special",
+    "enforceCriticalRules", "applyWeekEnd", "eventRoll", "save", "load",
+};
+
+// Counter
+// Calls of one phase and the ticks they took.
+struct Counter {
+    uint64_t calls = 0;
+    uint64_t ticks = 0;
+    uint64_t maxTicks = 0;
+};
+
+#ifdef SUMMER_ALLOCS
+// Allocations
+// Allocation counts per phase, with one more slot for allocations outside every phase. They are
+// shared atomics rather than per-thread tables because operator new can run before a thread's
+// tables exist or after they are gone; relaxed increments are cheap enough for a diagnostic build.
+struct Allocations {
+    std::atomic<uint64_t> heap[PhaseCount + 1];
+    std::atomic<uint64_t> heapBytes[PhaseCount + 1];
+    std::atomic<uint64_t> arena[PhaseCount + 1];
+    std::atomic<uint64_t> arenaBytes[PhaseCount + 1];
+};
+
+Allocations allocations; // zero-initialized before any code runs
+#endif
+
+// The innermost open phase on this thread (PhaseCount when none is). Plain data, so operator new
+// can read it at any time.
+thread_local int currentPhase = PhaseCount;
+
+// Totals
+// The process-wide counters, filled in as threads exit and written out when the program exits.
+// It also notes the clocks at startup so ticks can be converted to nanoseconds.
+class Totals {
+public:
+    Totals() : startTicks(now()), startTime(std::chrono::steady_clock::now()) {}
+
+    ~Totals() { write(); }
+
+    void add(const Counter (&counters)[PhaseCount])
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (int i = 0; i < PhaseCount; ++i) {
+            phases[i].calls += counters[i].calls;
+            phases[i].ticks += counters[i].ticks;
+            phases[i].maxTicks = std::max(phases[i].maxTicks, counters[i].maxTicks);
+        }
+    }
+
+private:
+    // write()
+    // Writes every phase as JSON. Phases that never ran are listed with zero calls.
+    void write()
+    {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+#ifdef PROFILE_TSC
+        uint64_t ticks = now() - startTicks;
+        double nsPerTick = ticks ? seconds * 1e9 / static_cast<double>(ticks) : 0.0;
+        const char *clock = "tsc";
+#else
+        double nsPerTick = 1.0;
+        const char *clock = "steady_clock";
+#endif
+        const char *path = std::getenv("SUMMER_PROFILE_OUT");
+        FILE *file = std::fopen(path && *path ? path : "profile.json", "w");
+        if (!file) return;
+        std::fprintf(file, "{\n  \"clock\": \"%s\",\n  \"nsPerTick\": %.6f,\n  \"seconds\": %.6f,\n  \"phases\": {\n",
+                     clock, nsPerTick, seconds);
+        for (int i = 0; i < PhaseCount; ++i) {
+            const Counter &c = phases[i];
+            double total = static_cast<double>(c.ticks) * nsPerTick;
+            std::fprintf(file, "    \"%s\": {\"calls\": %llu, \"totalNs\": %.0f, \"meanNs\": %.1f, \"maxNs\": %.0f",
+                         kPhaseNames[i], static_cast<unsigned long long>(c.calls), total,
+                         c.calls ? total / static_cast<double>(c.calls) : 0.0,
+                         static_cast<double>(c.maxTicks) * nsPerTick);
+#ifdef SUMMER_ALLOCS
+            writeAllocations(file, i);
+#endif
+            std::fprintf(file, "}%s\n", i + 1 < PhaseCount ? "," : "");
+        }
+#ifdef SUMMER_ALLOCS
+        std::fprintf(file, "  },\n  \"turns\": %llu,\n  \"outside\": {", static_cast<unsigned long long>(phases[Turn].calls));
+        writeAllocations(file, PhaseCount);
+        std::fprintf(file, "}\n}\n");
+#else
+        std::fprintf(file, "  }\n}\n");
+#endif
+        std::fclose(file);
+    }
+
+#ifdef SUMMER_ALLOCS
+    // writeAllocations()
+    // Writes one slot's allocation counts as JSON members, totals and per turn.
+    void writeAllocations(FILE *file, int slot)
+    {
+        double turns = static_cast<double>(std::max<uint64_t>(phases[Turn].calls, 1));
+        uint64_t heap = allocations.heap[slot].load();
+        uint64_t arena = allocations.arena[slot].load();
+        std::fprintf(file,
+                     "%s\"heapAllocations\": %llu, \"heapBytes\": %llu, \"arenaAllocations\": %llu, \"arenaBytes\": %llu, "
+                     "\"heapPerTurn\": %.3f, \"arenaPerTurn\": %.3f",
+                     slot < PhaseCount ? ", " : "", static_cast<unsigned long long>(heap),
+                     static_cast<unsigned long long>(allocations.heapBytes[slot].load()),
+                     static_cast<unsigned long long>(arena),
+                     static_cast<unsigned long long>(allocations.arenaBytes[slot].load()),
+                     static_cast<double>(heap) / turns, static_cast<double>(arena) / turns);
+    }
+#endif
+
+    std::mutex mutex;
+    Counter phases[PhaseCount];
+    uint64_t startTicks;
+    std::chrono::steady_clock::time_point startTime;
+};
+
+// totals()
+// Created before any thread's counters, so it is destroyed after them.
+Totals &totals()
+{
+    static Totals instance;
+    return instance;
+}
+
+// Makes the totals at startup, so the clocks are noted early and a file is written even when no
+// phase ran.
+const bool started = (totals(), true);
+
+// ThreadCounters
+// One thread's counters; added to the totals when the thread exits.
+struct ThreadCounters {
+    Counter phases[PhaseCount];
+    Totals &owner = totals();
+
+    ~ThreadCounters() { owner.add(phases); }
+};
+
+thread_local ThreadCounters counters;
+thread_local Clock *currentClock = nullptr;
+
+// parkedTicks()
+// Returns the ticks the running session has spent parked, or 0 outside a session.
+uint64_t parkedTicks()
+{
+    return currentClock ? currentClock->parked : 0;
+}
+
+} // anonymous namespace
+
+// now()
+uint64_t now()
+{
+#ifdef PROFILE_TSC
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#endif
+}
+
+// setClock()
+// Outside any session the thread's own phase is kept in threadPhase.
+Clock *setClock(Clock *clock)
+{
+    thread_local int threadPhase = PhaseCount;
+    Clock *previous = currentClock;
+    (previous ? previous->phase : threadPhase) = currentPhase;
+    currentClock = clock;
+    currentPhase = clock ? clock->phase : threadPhase;
+    return previous;
+}
+
+// countArena()
+void countArena(size_t bytes)
+{
+#ifdef SUMMER_ALLOCS
+    allocations.arena[currentPhase].fetch_add(1, std::memory_order_relaxed);
+    allocations.arenaBytes[currentPhase].fetch_add(bytes, std::memory_order_relaxed);
+#else
+    (void)bytes;
+#endif
+}
+
+// Scope::Scope()
+Scope::Scope(Phase phase_) : phase(phase_), outer(currentPhase), start(now()), parkedAtStart(parkedTicks())
+{
+    currentPhase = phase;
+}
+
+// Scope::~Scope()
+// The scope may end on another thread than it started on (a parked game can be resumed by any
+// worker); its time is counted on the thread it ends on.
+Scope::~Scope()
+{
+    currentPhase = outer;
+    uint64_t parked = parkedTicks() - parkedAtStart;
+    uint64_t elapsed = now() - start;
+    elapsed = elapsed > parked ? elapsed - parked : 0;
+    Counter &c = counters.phases[phase];
+    c.calls++;
+    c.ticks += elapsed;
+    c.maxTicks = std::max(c.maxTicks, elapsed);
+}
+
+} // namespace Profile
+
+#ifdef SUMMER_ALLOCS
+
+// AllocHook::counted()
+// Charges a heap allocation to the current phase (see allochook.h).
+void AllocHook::counted(std::size_t size)
+{
+    int phase = Profile::currentPhase;
+    Profile::allocations.heap[phase].fetch_add(1, std::memory_order_relaxed);
+    Profile::allocations.heapBytes[phase].fetch_add(size, std::memory_order_relaxed);
+}
+
+#endif // SUMMER_ALLOCS
+
+#endif // SUMMER_PROFILE
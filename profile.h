@@ -0,0 +1,119 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Counters and timers for the game's hot phases, for profiling builds only. Build with
+// `make PROFILE=1` (after `make clean`) to define SUMMER_PROFILE; otherwise PROFILE_SCOPE expands
+// to nothing and this header declares nothing else.
+//
+// `make PROFILE=allocs` also defines SUMMER_ALLOCS and links the replaced operator new and delete
+// (allochook.h), counting every heap allocation against the innermost phase on the thread (or "outside"
+// when none is), along with the allocations made from session arenas. Turn-loop phases report
+// their counts per turn, so the aim of a turn that allocates nothing can be measured.
+//
+// Each PROFILE_SCOPE counts one call of its phase and adds the time until the end of the enclosing
+// block. Times come from the CPU's time-stamp counter where there is one (x86-64) and from
+// steady_clock elsewhere, and are converted to nanoseconds when written. Phases nest: a week end
+// includes the events and critical-rule checks it runs. Counts go to per-thread tables without
+// locking; a thread's table is added to the process totals when the thread exits, and the totals
+// are written as JSON when the program exits, to $SUMMER_PROFILE_OUT or else profile.json.
+//
+// A phase may wait for the player (a choice's special effect or an event that asks something).
+// Inside a Session the time the game was parked is left out, so the numbers are the game's own
+// work; at the terminal, the time spent typing counts.
+
+#ifdef SUMMER_PROFILE
+
+namespace Profile {
+
+// Phase
+// What a scope measures; the names in the JSON are in kPhaseNames (profile.cpp).
+enum Phase {
+    SessionSetup,      // batch: making or recycling a session for the next game and copying its game function
+    Schedule,          // batch: queuing a game's next slice or the next game on the scheduler
+    Turn,              // one scenario slot, from showing it to the events after the choice
+    Display,           // printing stats, relationships, and the changes a choice made
+    Snapshot,          // copying the player and relationships before a choice
+    LoadWeek,          // Catalog::loadWeek(): building the week's scenarios and their choices
+    ScenarioLookup,    // finding the scenario for a slot
+    AvailabilityCheck, // Choice::isAvailable()
+    ApplyEffect,       // applyEffect()
+    Special,           // a choice's special effect script
+    CriticalRules,     // enforceCriticalRules()
+    WeekEnd,           // applyWeekEnd(), including its events
+    EventRoll,         // Catalog::runEvent(): rolling and running a random event
+    Save,              // SaveGame::save()
+    Load,              // SaveGame::load()
+    PhaseCount
+};
+
+// now()
+// Returns the current tick count. Input: none. Output: ticks.
+uint64_t now();
+
+// Clock
+// The ticks a session has spent parked, waiting for input, and the phase its game was in when it
+// parked. A session installs its clock while it runs (see setClock()) so scopes in its game can
+// leave those ticks out, and so allocations are charged to its phases rather than to those of
+// another game that ran on the thread in between.
+struct Clock {
+    uint64_t parked = 0;      // ticks spent parked so far
+    uint64_t parkedSince = 0; // when it last parked, or 0 while it runs
+    int phase = PhaseCount;   // innermost open phase; PhaseCount when none is
+};
+
+// setClock()
+// Installs the current thread's session clock, saving the thread's current phase in the clock
+// being replaced and taking up the new clock's.
+// Input: clock, or nullptr outside a session. Output: the previous clock.
+Clock *setClock(Clock *clock);
+
+// countArena()
+// Counts an allocation made from a session arena against the current phase (SUMMER_ALLOCS only).
+// Input: bytes. Output: none.
+void countArena(size_t bytes);
+
+// Scope
+// Times one call of a phase, from construction to destruction, and makes it the thread's current
+// phase meanwhile.
+class Scope {
+public:
+    explicit Scope(Phase phase);
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+private:
+    Phase phase;
+    int outer; // phase that was current before this scope
+    uint64_t start;
+    uint64_t parkedAtStart;
+};
+
+} // namespace Profile
+
+#define PROFILE_JOIN_(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN_(a, b)
+#define PROFILE_SCOPE(phase) Profile::Scope PROFILE_JOIN(profileScope, __LINE__)(Profile::phase)
+// PROFILE_CALL() evaluates one expression as a call of the phase and yields its value (a copy,
+// for an lvalue), e.g. a snapshot that must stay in the enclosing block.
+#define PROFILE_CALL(phase, ...) ([&]() { PROFILE_SCOPE(phase); return __VA_ARGS__; }())
+
+#ifdef SUMMER_ALLOCS
+#define PROFILE_ARENA_ALLOC(bytes) Profile::countArena(bytes)
+#else
+#define PROFILE_ARENA_ALLOC(bytes) ((void)0)
+#endif
+
+#else
+
+#define PROFILE_SCOPE(phase) ((void)0)
+#define PROFILE_CALL(phase, ...) (__VA_ARGS__)
+#define PROFILE_ARENA_ALLOC(bytes) ((void)0)
+
+#endif // SUMMER_PROFILE
+
+#endif // PROFILE_H
@@ -1,27 +1,50 @@
-#ifndef RELATIONSHIPS_H
-#define RELATIONSHIPS_H
-
-#include <string>
-#include <vector>
-
+#ifndef RELATIONSHIPS_H
+#define RELATIONSHIPS_H
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arena.h"
+
+// NPC
+// One relationship. The name is stored in the same memory as the list that holds it.
 struct NPC {
-    std::string name;
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    std::pmr::string name;
     int affinity; // 0-100
+
+    NPC(std::string_view name_, int affinity_, const allocator_type &alloc = {})
+        : name(name_, alloc), affinity(affinity_)
+    {
+    }
+    NPC(const NPC &other, const allocator_type &alloc) : name(other.name, alloc), affinity(other.affinity) {}
+    NPC(NPC &&other, const allocator_type &alloc) : name(std::move(other.name), alloc), affinity(other.affinity) {}
+    NPC(const NPC &) = default;
+    NPC(NPC &&) = default;
+    NPC &operator=(const NPC &) = default;
+    NPC &operator=(NPC &&) = default;
 };
 
 class Relationships {
 public:
-    std::vector<NPC> npcs;
+    std::pmr::vector<NPC> npcs{sessionMemory()};
 
     // Relationships()
     // Constructs a relationship tracker and seeds it with the core NPCs from the design doc.
     // Input: none. Output: Relationships instance with four default NPC entries.
     Relationships();
 
+    // Copies (such as the before/after snapshot around a choice) go to the current session's memory.
+    Relationships(const Relationships &other) : npcs(other.npcs, sessionMemory()) {}
+    Relationships &operator=(const Relationships &) = default;
+
     // interactWith()
     // Modifies affinity for a named NPC, creating one if it does not exist.
     // Input: NPC name (substring match) and signed affinity effect. Output: updated affinity clamped to [0,100].
-    void interactWith(const std::string &name, int effect);
+    void interactWith(std::string_view name, int effect);
 };
-
-#endif // RELATIONSHIPS_H
+
+#endif // RELATIONSHIPS_H
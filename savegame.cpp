@@ -1,5 +1,6 @@
 #include "savegame.h"
 #include "player.h"
+#include "profile.h"
 #include <fstream>
 #include <cstdio>
 #include <cerrno>
@@ -10,6 +11,7 @@
 // Output: true if the file was opened and written successfully; false on failure to open.
 bool SaveGame::save(const Player &p, int currentWeek, int scenario, const std::string &path)
 {
+    PROFILE_SCOPE(Save);
     std::ofstream ofs(path);
     if (!ofs) return false;
     ofs << currentWeek << " " << scenario << "\n";
@@ -23,6 +25,7 @@ bool SaveGame::save(const Player &p, int currentWeek, int scenario, const std::s
 // Output: true if all values were read successfully; false if the file cannot be opened.
 bool SaveGame::load(Player &p, int &currentWeek, int &scenario, const std::string &path)
 {
+    PROFILE_SCOPE(Load);
     std::ifstream ifs(path);
     if (!ifs) return false;
     ifs >> currentWeek >> scenario;
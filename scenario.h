@@ -0,0 +1,260 @@
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arena.h"
+#include "player.h"
+#include "profile.h"
+#include "relationships.h"
+#include "script.h"
+
+/**
+ * Effect
+ * Represents the effect of a choice on the player's stats and relationships.
+ * Inputs: 
+ *  - energy, health, social, academic, fitness, money: integers representing the change in respective stats.
+ *  - affinityDeltas: map of relationship affinity changes for specific NPCs (names point into the content pack).
+ * The map is allocated from the current session's memory, including when the effect is copied.
+ * Output: None (data structure).
+ */
+
+struct Effect {
+    int energy = 0;
+    int health = 0;
+    int social = 0;
+    int academic = 0;
+    int fitness = 0;
+    int money = 0;
+    std::pmr::map<std::string_view, int> affinityDeltas{sessionMemory()};
+
+    Effect(int energy_ = 0, int health_ = 0, int social_ = 0, int academic_ = 0,
+           int fitness_ = 0, int money_ = 0)
+        : energy(energy_), health(health_), social(social_),
+          academic(academic_), fitness(fitness_), money(money_)
+    {
+    }
+
+    Effect(const Effect& other)
+        : energy(other.energy), health(other.health), social(other.social), academic(other.academic),
+          fitness(other.fitness), money(other.money), affinityDeltas(other.affinityDeltas, sessionMemory())
+    {
+    }
+    Effect(Effect&&) = default;
+    Effect& operator=(const Effect&) = default;
+    Effect& operator=(Effect&&) = default;
+};
+
+/**
+ * GameState
+ * Stores the current state of the game, including flags for events, week progress, and relationship paths.
+ * Inputs: None (data structure).
+ * Output: None (data structure).
+ */
+
+// Number of weeks in a summer.
+constexpr int kSummerWeeks = 8;
+
+// GameOverCause
+// What ended a game early, for reports.
+enum class GameOverCause {
+    None,       // still alive, or survived
+    Bankrupt,   // ran out of money during the summer (enforceCriticalRules)
+    Illness,    // health at 0 at the final check
+    Exhaustion, // energy at 0 at the final check
+    Broke,      // money at 0 at the final check
+    Story       // a content script ended the game
+};
+
+struct GameState {
+    int currentWeek = 1;
+    bool skipNextScenario = false;
+    bool visitedGym = false;
+    bool metSam = false;
+    bool metRiley = false;
+    bool employed = false;
+    std::pmr::string relationshipPath{"open", sessionMemory()}; // open, partner, single, drama, avoidance
+    std::pmr::string partnerName{sessionMemory()};
+    bool gameOver = false;
+    GameOverCause gameOverCause = GameOverCause::None;
+    int hospitalVisits = 0; // forced by enforceCriticalRules
+    int collapses = 0;      // likewise
+    // Week 1 random-event flags
+    bool week1FriendEventDone = false;
+    bool week1RouterEventDone = false;
+    bool week1EveningEventDone = false;
+};
+
+/**
+ * Choice
+ * Represents a choice the player can make in a scenario.
+ * Inputs:
+ *  - title: string representing the choice name.
+ *  - detail: string providing additional description of the choice.
+ *  - effect: Effect object describing the impact of the choice on player stats and relationships.
+ *  - script: compiled special effect executed when the choice is selected (invalid if none).
+ *  - when: compiled condition checking if the choice is available (invalid if always available).
+ *  - lockReason: string explaining why the choice is locked (if applicable).
+ * Text fields and scripts point into the loaded content pack (see Content::Catalog).
+ * Output: None (data structure).
+ */
+
+struct Choice {
+    std::string_view title;
+    std::string_view detail;
+    Effect effect;
+    const Script::Image* image = nullptr;
+    Script::Entry script;
+    Script::Entry when;
+    std::string_view lockReason;
+
+    Choice(std::string_view title_ = std::string_view(),
+           std::string_view detail_ = std::string_view(),
+           const Effect& effect_ = Effect())
+        : title(title_), detail(detail_), effect(effect_)
+    {
+    }
+
+    // isAvailable()
+    // Evaluates the choice's condition. Input: read-only game objects. Output: true if it can be picked.
+    bool isAvailable(const GameState& state, const Player& player, const Relationships& rels) const
+    {
+        PROFILE_SCOPE(AvailabilityCheck);
+        return !when.valid() || Script::test(*image, when, state, player, rels);
+    }
+
+    // runScript()
+    // Runs the choice's special effect, if it has one; co_await it, since the effect may ask the
+    // player something. Input: game objects to update. Output: none.
+    Task<void> runScript(GameState& state, Player& player, Relationships& rels) const
+    {
+        if (!script.valid()) co_return;
+        PROFILE_SCOPE(Special);
+        co_await Script::run(*image, script, state, player, rels);
+    }
+};
+
+/**
+ * Scenario
+ * Represents a single scenario in the game, including the location, prompt text, and available choices.
+ * Inputs:
+ *  - week: integer indicating which week the scenario belongs to.
+ *  - index: integer indicating the order of the scenario in the week.
+ *  - location: string representing the scenario's location.
+ *  - prompt: string containing the scenario's description.
+ *  - choices: vector of Choice objects representing the player's options.
+ * Text fields are views into the loaded content pack (see Content::Catalog); the choice list is
+ * allocated from the current session's memory.
+ * Output: None (data structure).
+ */
+
+struct Scenario {
+    int week;
+    int index; // 1..4 per week
+    std::string_view location;
+    std::string_view prompt;
+    std::pmr::vector<Choice> choices{sessionMemory()};
+};
+
+/**
+ * Decision
+ * The options on screen at a scenario prompt, handed out with the prompt (Prompt::decision) so a
+ * bot can pick between them. Valid until the prompt is answered.
+ * Inputs:
+ *  - scenario: the scenario being played.
+ *  - available: indices into scenario->choices of the unlocked choices, in menu order (answer n picks available[n - 1]).
+ *  - count: number of unlocked choices.
+ *  - state, player, rels: the game as it stands before the choice.
+ * Output: None (data structure).
+ */
+
+struct Decision {
+    const Scenario* scenario = nullptr;
+    const int* available = nullptr;
+    int count = 0;
+    const GameState* state = nullptr;
+    const Player* player = nullptr;
+    const Relationships* rels = nullptr;
+
+    // option()
+    // Returns the n-th unlocked choice (0-based). Input: menu position. Output: the choice.
+    const Choice& option(int n) const { return scenario->choices[available[n]]; }
+};
+
+/**
+ * Outcome
+ * How a finished game ended, reported once through the thread's GameObserver.
+ * Inputs:
+ *  - gameOver: true if the player did not survive (during the summer or at the final check).
+ *  - week: the week the game ended in.
+ *  - ending: name of the ending (empty on a game over).
+ *  - stars: ending rating, 0 on a game over.
+ *  - cause: what ended the game on a game over.
+ *  - path: relationship path (open, partner, single, drama, avoidance, or other).
+ *  - hospitalVisits, collapses: how often the critical rules stepped in.
+ *  - player, rels: final stats and relationships.
+ * Output: None (data structure).
+ */
+
+struct Outcome {
+    bool gameOver = false;
+    int week = 0;
+    std::string_view ending;
+    int stars = 0;
+    GameOverCause cause = GameOverCause::None;
+    std::string_view path; // static text
+    int hospitalVisits = 0;
+    int collapses = 0;
+    Player player;
+    const Relationships* rels = nullptr; // valid only during gameEnded()
+};
+
+// GameObserver
+// Listener for structured reports from the game on this thread (see setGameObserver() in util.h).
+class GameObserver {
+public:
+    virtual ~GameObserver() = default;
+
+    // gameEnded()
+    // Called once when the game reaches its closing sequence. Input: the outcome. Output: none.
+    virtual void gameEnded(const Outcome& outcome) = 0;
+
+    // weekEnded()
+    // Called after each week's end-of-week effects. Input: the week and the player's stats. Output: none.
+    virtual void weekEnded(int week, const Player& player)
+    {
+        (void)week;
+        (void)player;
+    }
+
+    // choiceMade()
+    // Called after a scenario choice, its special effect, and the critical rules have been applied.
+    // Input: week, slot, the choice's index in the scenario, the number of unlocked choices, and the
+    // stats before and after. Output: none.
+    virtual void choiceMade(int week, int slot, int choice, int available, const Player& before, const Player& after)
+    {
+        (void)week;
+        (void)slot;
+        (void)choice;
+        (void)available;
+        (void)before;
+        (void)after;
+    }
+
+    // eventRan()
+    // Called after a random event script has run. Input: week, event name, and the stats before
+    // and after. Output: none.
+    virtual void eventRan(int week, std::string_view name, const Player& before, const Player& after)
+    {
+        (void)week;
+        (void)name;
+        (void)before;
+        (void)after;
+    }
+};
+
+#endif // SCENARIO_H
@@ -0,0 +1,181 @@
+#include "scheduler.h"
+#include "trace.h"
+#include <pthread.h>
+#include <sched.h>
+
+namespace {
+
+// The pool and worker index of the calling thread.
+thread_local const Scheduler *currentPool = nullptr;
+thread_local int currentIndex = -1;
+
+// lockQueue()
+// Locks a run queue. While tracing, a lock that was not free right away is recorded as a wait.
+std::unique_lock<std::mutex> lockQueue(std::mutex &lock)
+{
+    if (!Trace::enabled()) return std::unique_lock<std::mutex>(lock);
+    if (lock.try_lock()) return std::unique_lock<std::mutex>(lock, std::adopt_lock);
+    uint64_t begin = Trace::now();
+    std::unique_lock<std::mutex> guard(lock);
+    Trace::record("lock wait", begin, Trace::now());
+    return guard;
+}
+
+} // anonymous namespace
+
+// Scheduler::Scheduler()
+// Creates one queue per worker before any worker starts, so stealing never sees a partial pool.
+Scheduler::Scheduler(int workers, bool pin)
+{
+    if (workers <= 0) workers = static_cast<int>(std::thread::hardware_concurrency());
+    if (workers < 1) workers = 1;
+    for (int i = 0; i < workers; ++i) queues.emplace_back(new Queue());
+    for (int i = 0; i < workers; ++i) threads.emplace_back([this, i, pin]() { work(i, pin); });
+}
+
+// Scheduler::~Scheduler()
+// Lets the workers run out of jobs, then joins them.
+Scheduler::~Scheduler()
+{
+    wait();
+    {
+        std::lock_guard<std::mutex> guard(idleLock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread &thread : threads) thread.join();
+}
+
+// Scheduler::post()
+// Appends the job to the chosen queue and wakes a sleeping worker.
+void Scheduler::post(Job job, int worker)
+{
+    if (worker < 0 || worker >= size()) {
+        worker = currentPool == this ? currentIndex : static_cast<int>(nextQueue++ % queues.size());
+    }
+    pending++;
+    {
+        Queue &queue = *queues[worker];
+        std::unique_lock<std::mutex> guard = lockQueue(queue.lock);
+        queue.jobs.push_back(std::move(job));
+        queued++;
+    }
+    {
+        std::lock_guard<std::mutex> guard(idleLock); // pairs with the predicate check in work()
+    }
+    wake.notify_one();
+}
+
+// Scheduler::wait()
+// Sleeps until the pending count reaches zero.
+void Scheduler::wait()
+{
+    std::unique_lock<std::mutex> guard(idleLock);
+    drained.wait(guard, [this]() { return pending.load() == 0; });
+}
+
+// Scheduler::stats()
+// Reads the counters.
+Scheduler::Stats Scheduler::stats() const
+{
+    Stats result;
+    result.executed = executed.load();
+    result.stolen = stolen.load();
+    return result;
+}
+
+// Scheduler::currentWorker()
+// Reports the calling thread's worker index.
+int Scheduler::currentWorker()
+{
+    return currentIndex;
+}
+
+// Scheduler::pinToCore()
+// Restricts the calling thread to one CPU from its current affinity mask.
+bool Scheduler::pinToCore(int index)
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return false;
+    int count = CPU_COUNT(&allowed);
+    if (count < 1) return false;
+    int wanted = index % count;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (!CPU_ISSET(cpu, &allowed)) continue;
+        if (wanted-- == 0) {
+            cpu_set_t one;
+            CPU_ZERO(&one);
+            CPU_SET(cpu, &one);
+            return pthread_setaffinity_np(pthread_self(), sizeof(one), &one) == 0;
+        }
+    }
+    return false;
+}
+
+// Scheduler::take()
+// Pops the oldest job from the worker's own queue, or else steals the newest job from the longest
+// other queue (the one most likely to leave its worker busy).
+// Input: worker index, job to fill. Output: false if every queue was empty.
+bool Scheduler::take(int index, Job &job)
+{
+    {
+        Queue &own = *queues[index];
+        std::unique_lock<std::mutex> guard = lockQueue(own.lock);
+        if (!own.jobs.empty()) {
+            job = std::move(own.jobs.front());
+            own.jobs.pop_front();
+            queued--;
+            return true;
+        }
+    }
+    while (queued.load() > 0) {
+        int victim = -1;
+        size_t longest = 0;
+        for (int i = 0; i < size(); ++i) {
+            if (i == index) continue;
+            Queue &other = *queues[i];
+            std::unique_lock<std::mutex> guard = lockQueue(other.lock);
+            if (other.jobs.size() > longest) {
+                longest = other.jobs.size();
+                victim = i;
+            }
+        }
+        if (victim < 0) return false;
+        Queue &other = *queues[victim];
+        std::unique_lock<std::mutex> guard = lockQueue(other.lock);
+        if (other.jobs.empty()) continue; // its owner got there first
+        job = std::move(other.jobs.back());
+        other.jobs.pop_back();
+        queued--;
+        stolen++;
+        return true;
+    }
+    return false;
+}
+
+// Scheduler::work()
+// Worker loop: run jobs while there are any, sleep when every queue is empty.
+void Scheduler::work(int index, bool pin)
+{
+    currentPool = this;
+    currentIndex = index;
+    if (pin) pinToCore(index);
+    Job job;
+    for (;;) {
+        if (take(index, job)) {
+            job();
+            job = nullptr;
+            executed++;
+            if (--pending == 0) {
+                std::lock_guard<std::mutex> guard(idleLock);
+                drained.notify_all();
+            }
+            continue;
+        }
+        TRACE_SPAN("idle");
+        std::unique_lock<std::mutex> guard(idleLock);
+        wake.wait(guard, [this]() { return queued.load() > 0 || stopping; });
+        if (stopping && queued.load() == 0) return;
+    }
+}
@@ -0,0 +1,94 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Scheduler
+// Fixed pool of worker threads for CPU-bound batches of sessions (bot games, simulations). Each
+// worker is pinned to its own core and has its own run queue. A job posted from a worker goes to
+// that worker's queue, so a session that posts its next step after each one stays on one core with
+// its frames in that core's cache. A worker whose queue is empty steals the newest job from the
+// longest other queue, and the stolen session then stays with its new worker.
+//
+// Jobs must not block; a session step runs to its next prompt and returns.
+class Scheduler {
+public:
+    using Job = std::function<void()>;
+
+    // Stats
+    // Counters since the scheduler started.
+    struct Stats {
+        uint64_t executed = 0; // jobs run
+        uint64_t stolen = 0;   // jobs run by a worker other than the one they were posted to
+    };
+
+    // Scheduler()
+    // Starts the workers.
+    // Input: number of workers (0 means one per CPU) and whether to pin them to cores.
+    explicit Scheduler(int workers = 0, bool pin = true);
+
+    // ~Scheduler()
+    // Finishes every queued job, then stops the workers.
+    ~Scheduler();
+
+    Scheduler(const Scheduler &) = delete;
+    Scheduler &operator=(const Scheduler &) = delete;
+
+    // size()
+    // Returns the number of workers.
+    int size() const { return static_cast<int>(queues.size()); }
+
+    // post()
+    // Queues a job on a worker.
+    // Input: the job, and the worker to run it on; -1 means the calling worker, or round robin when
+    // called from outside the pool. Output: none.
+    void post(Job job, int worker = -1);
+
+    // wait()
+    // Blocks until every posted job, including jobs posted by jobs, has finished.
+    void wait();
+
+    // stats()
+    // Returns the job counters.
+    Stats stats() const;
+
+    // currentWorker()
+    // Returns the index of the worker running the calling thread, or -1 outside the pool.
+    static int currentWorker();
+
+    // pinToCore()
+    // Pins the calling thread to the index-th CPU it is allowed to run on (wrapping around).
+    // Input: index. Output: false if the affinity could not be set.
+    static bool pinToCore(int index);
+
+private:
+    struct Queue {
+        std::mutex lock;
+        std::deque<Job> jobs;
+    };
+
+    void work(int index, bool pin);
+    bool take(int index, Job &job);
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+    std::mutex idleLock;
+    std::condition_variable wake;    // a job was queued, or the pool is stopping
+    std::condition_variable drained; // pending dropped to zero
+    std::atomic<size_t> queued{0};   // jobs sitting in queues
+    std::atomic<size_t> pending{0};  // jobs posted and not yet finished
+    std::atomic<unsigned> nextQueue{0};
+    std::atomic<uint64_t> executed{0};
+    std::atomic<uint64_t> stolen{0};
+    bool stopping = false;
+};
+
+#endif // SCHEDULER_H
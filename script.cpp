@@ -0,0 +1,1213 @@
+#include "script.h"
+#include "output.h"
+#include "player.h"
+#include "relationships.h"
+#include "scenario.h"
+#include "util.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+
+namespace Script {
+
+namespace {
+
+// Game variables that scripts can read and write by name.
+enum Var {
+    VarEnergy, VarHealth, VarSocial, VarAcademic, VarFitness, VarMoney,
+    VarCurrentWeek, VarVisitedGym, VarMetSam, VarMetRiley, VarEmployed,
+    VarSkipNextScenario, VarGameOver, VarWeek1FriendEventDone, VarWeek1RouterEventDone,
+    VarWeek1EveningEventDone, VarRelationshipPath, VarPartnerName,
+    VarCount
+};
+
+const char *const kVarNames[VarCount] = {
+    "energy", "health", "social", "academic", "fitness", "money",
+    "currentWeek", "visitedGym", "metSam", "metRiley", "employed",
+    "skipNextScenario", "gameOver", "week1FriendEventDone", "week1RouterEventDone",
+    "week1EveningEventDone", "relationshipPath", "partnerName"
+};
+
+bool isStat(int var) { return var <= VarMoney; }
+
+// Builtin functions callable from scripts.
+enum Builtin {
+    FnRoll, FnAsk, FnRead, FnRand, FnNpcCount, FnNpcName, FnNpcAffinity,
+    FnSetAffinity, FnInteract, FnContains, FnMax, FnMin, FnChance, FnRandom, FnSleep,
+    FnClampStats, FnCount
+};
+
+struct BuiltinInfo {
+    const char *name;
+    int args;
+    bool pure; // allowed inside "when" conditions
+};
+
+const BuiltinInfo kBuiltins[FnCount] = {
+    {"roll", 1, false},
+    {"ask", 2, false},
+    {"read", 0, false},
+    {"rand", 0, false},
+    {"npcCount", 0, true},
+    {"npcName", 1, true},
+    {"npcAffinity", 1, true},
+    {"setAffinity", 2, false},
+    {"interact", 2, false},
+    {"contains", 2, true},
+    {"max", 2, true},
+    {"min", 2, true},
+    {"chance", 1, false},
+    {"random", 0, false},
+    {"sleep", 1, false},
+    {"clampStats", 0, false},
+};
+
+int findVar(const std::string &name)
+{
+    for (int i = 0; i < VarCount; ++i) {
+        if (name == kVarNames[i]) return i;
+    }
+    return -1;
+}
+
+int findBuiltin(const std::string &name)
+{
+    for (int i = 0; i < FnCount; ++i) {
+        if (name == kBuiltins[i].name) return i;
+    }
+    return -1;
+}
+
+bool isKeyword(const std::string &name)
+{
+    return name == "let" || name == "if" || name == "else" || name == "for" || name == "in" ||
+           name == "break" || name == "return" || name == "say" || name == "print" ||
+           name == "true" || name == "false" || name == "event";
+}
+
+} // anonymous namespace
+
+// ---------------------------------------------------------------------------
+// Lexer
+// ---------------------------------------------------------------------------
+
+// Lexer::Lexer()
+// Prepares a lexer over the given source text and reads the first token.
+// Input: full source text. Output: lexer positioned on the first token.
+Lexer::Lexer(const std::string &source)
+    : src(source)
+{
+    advance();
+}
+
+// Lexer::next()
+// Consumes the current token and returns it.
+// Input: none. Output: the token that was current before the call.
+Token Lexer::next()
+{
+    Token t = current;
+    advance();
+    return t;
+}
+
+// Lexer::accept()
+// Consumes the current token if its text matches (identifiers and punctuation only).
+// Input: expected text. Output: true if consumed.
+bool Lexer::accept(const std::string &text)
+{
+    if ((current.kind == Tok::Punct || current.kind == Tok::Ident) && current.text == text) {
+        advance();
+        return true;
+    }
+    return false;
+}
+
+// Lexer::expect()
+// Consumes the expected token or records an error naming what was found instead.
+// Input: expected text. Output: true if consumed.
+bool Lexer::expect(const std::string &text)
+{
+    if (accept(text)) return true;
+    fail("expected '" + text + "'");
+    return false;
+}
+
+// Lexer::fail()
+// Stores the first error message, prefixed with the line of the current token.
+// Input: message. Output: error recorded; later calls are ignored.
+void Lexer::fail(const std::string &message)
+{
+    if (!error.empty()) return;
+    std::string found = current.kind == Tok::End ? "end of file" : "'" + current.text + "'";
+    if (current.kind == Tok::Number) found = "number";
+    if (current.kind == Tok::String) found = "string";
+    error = "line " + std::to_string(current.line) + ": " + message + " (found " + found + ")";
+}
+
+// Lexer::failAt()
+// Like fail(), for problems only detectable later, such as a call to an event that is never defined.
+// Input: line of the offending code and message. Output: error recorded if none was yet.
+void Lexer::failAt(int line, const std::string &message)
+{
+    if (!error.empty()) return;
+    error = "line " + std::to_string(line) + ": " + message;
+}
+
+// Lexer::advance()
+// Reads the next token from the source, skipping whitespace and comments and
+// joining adjacent string literals into one.
+// Input: none. Output: current token updated.
+void Lexer::advance()
+{
+    auto skipSpace = [this]() {
+        while (pos < src.size()) {
+            char c = src[pos];
+            if (c == '\n') {
+                ++line;
+                ++pos;
+            } else if (std::isspace(static_cast<unsigned char>(c))) {
+                ++pos;
+            } else if (c == '#') {
+                while (pos < src.size() && src[pos] != '\n') ++pos;
+            } else {
+                break;
+            }
+        }
+    };
+
+    skipSpace();
+    current = Token();
+    current.line = line;
+    if (pos >= src.size()) {
+        current.kind = Tok::End;
+        return;
+    }
+
+    char c = src[pos];
+    if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+        size_t start = pos;
+        while (pos < src.size() && (std::isalnum(static_cast<unsigned char>(src[pos])) || src[pos] == '_')) ++pos;
+        current.kind = Tok::Ident;
+        current.text = src.substr(start, pos - start);
+        return;
+    }
+
+    if (std::isdigit(static_cast<unsigned char>(c))) {
+        size_t start = pos;
+        while (pos < src.size() && (std::isdigit(static_cast<unsigned char>(src[pos])) || src[pos] == '.')) ++pos;
+        current.kind = Tok::Number;
+        current.text = src.substr(start, pos - start);
+        current.number = std::strtod(current.text.c_str(), nullptr);
+        return;
+    }
+
+    if (c == '"') {
+        current.kind = Tok::String;
+        // Adjacent literals ("a" "b") form a single string, as in C.
+        while (pos < src.size() && src[pos] == '"') {
+            ++pos;
+            while (pos < src.size() && src[pos] != '"') {
+                char ch = src[pos++];
+                if (ch == '\n') {
+                    current.line = line;
+                    fail("unterminated string");
+                    return;
+                }
+                if (ch == '\\' && pos < src.size()) {
+                    char esc = src[pos++];
+                    switch (esc) {
+                    case 'n': ch = '\n'; break;
+                    case 't': ch = '\t'; break;
+                    case '0': ch = '\0'; break;
+                    default: ch = esc; break; // \" \\ \'
+                    }
+                }
+                current.text += ch;
+            }
+            if (pos >= src.size()) {
+                fail("unterminated string");
+                return;
+            }
+            ++pos; // closing quote
+            size_t save = pos;
+            int saveLine = line;
+            skipSpace();
+            if (pos >= src.size() || src[pos] != '"') {
+                pos = save;
+                line = saveLine;
+                break;
+            }
+        }
+        return;
+    }
+
+    static const char *const twoChar[] = {"==", "!=", "<=", ">=", "&&", "||", "+=", "-="};
+    current.kind = Tok::Punct;
+    for (const char *op : twoChar) {
+        if (src.compare(pos, 2, op) == 0) {
+            current.text = op;
+            pos += 2;
+            return;
+        }
+    }
+    current.text = std::string(1, c);
+    ++pos;
+    if (std::string("{}(),;=<>+-*/%!?:").find(c) == std::string::npos) {
+        fail("unexpected character");
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Compiler
+// ---------------------------------------------------------------------------
+
+// Program::addString()
+// Interns a string constant so identical texts share one table entry.
+// Input: string. Output: index into strings.
+int Program::addString(const std::string &s)
+{
+    auto it = stringIds.find(s);
+    if (it != stringIds.end()) return it->second;
+    int id = static_cast<int>(strings.size());
+    strings.push_back(s);
+    stringIds.emplace(s, id);
+    return id;
+}
+
+// Compiler::Compiler()
+// Binds a compiler to the program it appends to and the lexer it reads from.
+// Input: target Program and source Lexer. Output: ready-to-use compiler.
+Compiler::Compiler(Program &program, Lexer &lexer)
+    : prog(program), lex(lexer)
+{
+}
+
+// Compiler::compileBlock()
+// Compiles one "{ ... }" script and terminates it with a Return.
+// Input: none. Output: Entry describing the new script, invalid if compilation failed.
+Entry Compiler::compileBlock()
+{
+    locals.clear();
+    slotCount = 0;
+    pure = false;
+    Entry e;
+    e.pc = static_cast<int>(prog.code.size());
+    block();
+    emit(Op::Return);
+    e.locals = slotCount;
+    if (lex.failed()) e.pc = -1;
+    return e;
+}
+
+// Compiler::compileCondition()
+// Compiles one expression that may only read game state.
+// Input: none. Output: Entry describing the condition, invalid if compilation failed.
+Entry Compiler::compileCondition()
+{
+    locals.clear();
+    slotCount = 0;
+    pure = true;
+    Entry e;
+    e.pc = static_cast<int>(prog.code.size());
+    expression();
+    emit(Op::Return);
+    pure = false;
+    if (lex.failed()) e.pc = -1;
+    return e;
+}
+
+// Compiler::compileEvent()
+// Compiles an event body and fills in its table entry, which may already exist if the event
+// was called earlier in the file.
+// Input: event name. Output: true on success.
+bool Compiler::compileEvent(const std::string &name)
+{
+    if (isKeyword(name) || findVar(name) >= 0 || findBuiltin(name) >= 0) {
+        lex.fail("'" + name + "' cannot be used as an event name");
+        return false;
+    }
+    int index = findEvent(name, lex.peek().line);
+    if (prog.events[index].pc >= 0) {
+        lex.fail("event '" + name + "' is already defined");
+        return false;
+    }
+    Entry e = compileBlock();
+    if (!e.valid()) return false;
+    prog.events[index].pc = e.pc;
+    prog.events[index].locals = e.locals;
+    return true;
+}
+
+// Compiler::finish()
+// Called after the whole file is compiled, when every event definition has been seen.
+// Input: none. Output: true if no called event is missing.
+bool Compiler::finish()
+{
+    for (size_t i = 0; i < prog.events.size() && !lex.failed(); ++i) {
+        if (prog.events[i].pc < 0) {
+            lex.failAt(eventLines[i], "unknown function '" + prog.strings[prog.events[i].name] + "'");
+        }
+    }
+    return !lex.failed();
+}
+
+// Returns the event table index for a name, adding an undefined entry on first use.
+int Compiler::findEvent(const std::string &name, int line)
+{
+    uint32_t id = static_cast<uint32_t>(prog.addString(name));
+    for (size_t i = 0; i < prog.events.size(); ++i) {
+        if (prog.events[i].name == id) return static_cast<int>(i);
+    }
+    prog.events.push_back({id, -1, 0});
+    eventLines.push_back(line);
+    return static_cast<int>(prog.events.size()) - 1;
+}
+
+int Compiler::emit(Op op, int a, double num)
+{
+    if (fuse(op, a)) return static_cast<int>(prog.code.size()) - 1;
+    Instr in;
+    in.op = op;
+    in.a = a;
+    in.num = num;
+    prog.code.push_back(in);
+    return static_cast<int>(prog.code.size()) - 1;
+}
+
+// Compiler::fuse()
+// Peephole step run before each emit: folds the instruction about to be emitted into the ones
+// just before it when together they form a superinstruction (see Op) or a negated constant.
+// Instructions are only merged when no jump lands between them.
+// Input: opcode and operand about to be emitted. Output: true if it was folded in.
+bool Compiler::fuse(Op op, int a)
+{
+    std::vector<Instr> &code = prog.code;
+    const int size = static_cast<int>(code.size());
+    // Index of the first of the last n instructions, if they can be merged with the new one.
+    auto tail = [&](int n) { return size >= n && lastTarget <= size - n ? size - n : -1; };
+
+    int at = tail(1);
+    if (at < 0) return false;
+    Instr &prev = code[at];
+    if (op == Op::Neg && prev.op == Op::PushNum) {
+        prev.num = -prev.num;
+        return true;
+    }
+    if (op == Op::Say && a == 1 && prev.op == Op::PushStr) {
+        prev.op = Op::SayStr;
+        return true;
+    }
+    if ((op == Op::AdjustVar || (op == Op::StoreVar && a < VarRelationshipPath)) && prev.op == Op::PushNum) {
+        prev.op = op == Op::AdjustVar ? Op::AdjustBy : Op::SetVar;
+        prev.a = a;
+        return true;
+    }
+    if (op == Op::Call && a == FnRoll && prev.op == Op::PushNum) {
+        prev.op = Op::Roll;
+        return true;
+    }
+    at = tail(2);
+    if (at < 0) return false;
+    if (op == Op::JumpIfFalse && code[at].op == Op::PushNum && code[at + 1].op == Op::Eq) {
+        code[at].op = Op::JumpIfNotNum;
+        code.pop_back();
+        return true;
+    }
+    at = tail(3);
+    if (op == Op::Pop && at >= 0 && code[at].op == Op::PushStr && code[at + 1].op == Op::PushNum &&
+        code[at + 2].op == Op::Call && code[at + 2].a == FnInteract) {
+        code[at].op = Op::Interact;
+        code[at].num = code[at + 1].num;
+        code.resize(at + 1);
+        return true;
+    }
+    return false;
+}
+
+// Points the jump at the given index to the next instruction to be emitted.
+void Compiler::patch(int at)
+{
+    prog.code[at].a = static_cast<int>(prog.code.size());
+    markTarget(prog.code[at].a);
+}
+
+// Records that a jump lands on the given index, so fuse() never merges across it.
+void Compiler::markTarget(int at)
+{
+    lastTarget = std::max(lastTarget, at);
+}
+
+int Compiler::findLocal(const std::string &name) const
+{
+    for (size_t i = locals.size(); i-- > 0;) {
+        if (locals[i].name == name) return locals[i].slot;
+    }
+    return -1;
+}
+
+int Compiler::declareLocal(const std::string &name)
+{
+    if (isKeyword(name) || findVar(name) >= 0) {
+        lex.fail("'" + name + "' cannot be used as a local name");
+        return 0;
+    }
+    locals.push_back({name, slotCount});
+    return slotCount++;
+}
+
+void Compiler::block()
+{
+    if (!lex.expect("{")) return;
+    size_t scope = locals.size();
+    while (!lex.failed() && !lex.accept("}")) {
+        if (lex.peek().kind == Tok::End) {
+            lex.fail("missing '}'");
+            break;
+        }
+        statement();
+    }
+    locals.resize(scope);
+}
+
+void Compiler::statement()
+{
+    const Token &t = lex.peek();
+    if (t.kind == Tok::Punct && t.text == ";") {
+        lex.next();
+        return;
+    }
+    if (t.kind != Tok::Ident) {
+        lex.fail("expected a statement");
+        return;
+    }
+
+    std::string word = t.text;
+    int line = t.line;
+    if (word == "if") {
+        ifStatement();
+    } else if (word == "for") {
+        forStatement();
+    } else if (word == "let") {
+        lex.next();
+        Token name = lex.next();
+        if (name.kind != Tok::Ident) {
+            lex.fail("expected a local name after 'let'");
+            return;
+        }
+        if (!lex.expect("=")) return;
+        expression();
+        emit(Op::Store, declareLocal(name.text));
+    } else if (word == "break") {
+        lex.next();
+        if (breakJumps.empty()) {
+            lex.fail("'break' outside of a loop");
+            return;
+        }
+        breakJumps.back().push_back(emit(Op::Jump));
+    } else if (word == "return") {
+        lex.next();
+        emit(Op::Return);
+    } else if (word == "say" || word == "print") {
+        lex.next();
+        int count = 0;
+        // Arguments must start on the same line; a bare "say" prints an empty line.
+        const Token &arg = lex.peek();
+        if (arg.line == line && !(arg.kind == Tok::Punct && (arg.text == "}" || arg.text == ";"))) {
+            expression();
+            ++count;
+            while (!lex.failed() && lex.accept(",")) {
+                expression();
+                ++count;
+            }
+        }
+        if (pure) lex.fail("output is not allowed here");
+        emit(word == "say" ? Op::Say : Op::Print, count);
+    } else {
+        lex.next();
+        if (lex.peek().kind == Tok::Punct && lex.peek().text == "(") {
+            call(word);
+            emit(Op::Pop);
+        } else {
+            assignment(word);
+        }
+    }
+}
+
+void Compiler::ifStatement()
+{
+    lex.next(); // "if"
+    expression();
+    int skip = emit(Op::JumpIfFalse);
+    block();
+    if (lex.accept("else")) {
+        int end = emit(Op::Jump);
+        patch(skip);
+        if (lex.peek().kind == Tok::Ident && lex.peek().text == "if") {
+            ifStatement();
+        } else {
+            block();
+        }
+        patch(end);
+    } else {
+        patch(skip);
+    }
+}
+
+void Compiler::forStatement()
+{
+    lex.next(); // "for"
+    Token name = lex.next();
+    if (name.kind != Tok::Ident) {
+        lex.fail("expected a loop variable after 'for'");
+        return;
+    }
+    if (!lex.expect("in") || !lex.expect("npcs")) return;
+
+    size_t scope = locals.size();
+    int slot = declareLocal(name.text);
+    emit(Op::PushNum, 0, 0.0);
+    emit(Op::Store, slot);
+    int top = static_cast<int>(prog.code.size());
+    markTarget(top);
+    emit(Op::Load, slot);
+    emit(Op::Call, FnNpcCount, 0);
+    emit(Op::Lt);
+    int exit = emit(Op::JumpIfFalse);
+
+    breakJumps.emplace_back();
+    block();
+    emit(Op::Load, slot);
+    emit(Op::PushNum, 0, 1.0);
+    emit(Op::Add);
+    emit(Op::Store, slot);
+    emit(Op::Jump, top);
+    patch(exit);
+    for (int j : breakJumps.back()) patch(j);
+    breakJumps.pop_back();
+    locals.resize(scope);
+}
+
+void Compiler::assignment(const std::string &name)
+{
+    Token op = lex.next();
+    if (op.kind != Tok::Punct || (op.text != "=" && op.text != "+=" && op.text != "-=")) {
+        lex.fail("expected '=', '+=' or '-=' after '" + name + "'");
+        return;
+    }
+    int slot = findLocal(name);
+    int var = slot < 0 ? findVar(name) : -1;
+    if (slot < 0 && var < 0) {
+        lex.fail("unknown variable '" + name + "'");
+        return;
+    }
+    if (pure) {
+        lex.fail("assignment is not allowed here");
+        return;
+    }
+
+    if (op.text == "=") {
+        expression();
+    } else if (var >= 0 && isStat(var)) {
+        // Stat changes go through Player::adjust*() like the rest of the game.
+        expression();
+        if (op.text == "-=") emit(Op::Neg);
+        emit(Op::AdjustVar, var);
+        return;
+    } else {
+        emit(slot >= 0 ? Op::Load : Op::LoadVar, slot >= 0 ? slot : var);
+        expression();
+        emit(op.text == "+=" ? Op::Add : Op::Sub);
+    }
+    emit(slot >= 0 ? Op::Store : Op::StoreVar, slot >= 0 ? slot : var);
+}
+
+void Compiler::expression()
+{
+    ternary();
+}
+
+void Compiler::ternary()
+{
+    logicalOr();
+    if (lex.accept("?")) {
+        int otherwise = emit(Op::JumpIfFalse);
+        expression();
+        int end = emit(Op::Jump);
+        patch(otherwise);
+        if (!lex.expect(":")) return;
+        expression();
+        patch(end);
+    }
+}
+
+void Compiler::logicalOr()
+{
+    logicalAnd();
+    while (!lex.failed() && lex.accept("||")) {
+        int done = emit(Op::JumpIfTrueKeep);
+        logicalAnd();
+        patch(done);
+    }
+}
+
+void Compiler::logicalAnd()
+{
+    equality();
+    while (!lex.failed() && lex.accept("&&")) {
+        int done = emit(Op::JumpIfFalseKeep);
+        equality();
+        patch(done);
+    }
+}
+
+void Compiler::equality()
+{
+    comparison();
+    while (!lex.failed()) {
+        if (lex.accept("==")) {
+            comparison();
+            emit(Op::Eq);
+        } else if (lex.accept("!=")) {
+            comparison();
+            emit(Op::Ne);
+        } else {
+            break;
+        }
+    }
+}
+
+void Compiler::comparison()
+{
+    additive();
+    while (!lex.failed()) {
+        Op op;
+        if (lex.accept("<")) op = Op::Lt;
+        else if (lex.accept("<=")) op = Op::Le;
+        else if (lex.accept(">")) op = Op::Gt;
+        else if (lex.accept(">=")) op = Op::Ge;
+        else break;
+        additive();
+        emit(op);
+    }
+}
+
+void Compiler::additive()
+{
+    multiplicative();
+    while (!lex.failed()) {
+        if (lex.accept("+")) {
+            multiplicative();
+            emit(Op::Add);
+        } else if (lex.accept("-")) {
+            multiplicative();
+            emit(Op::Sub);
+        } else {
+            break;
+        }
+    }
+}
+
+void Compiler::multiplicative()
+{
+    unary();
+    while (!lex.failed()) {
+        Op op;
+        if (lex.accept("*")) op = Op::Mul;
+        else if (lex.accept("/")) op = Op::Div;
+        else if (lex.accept("%")) op = Op::Mod;
+        else break;
+        unary();
+        emit(op);
+    }
+}
+
+void Compiler::unary()
+{
+    if (lex.accept("!")) {
+        unary();
+        emit(Op::Not);
+    } else if (lex.accept("-")) {
+        unary();
+        emit(Op::Neg);
+    } else {
+        primary();
+    }
+}
+
+void Compiler::primary()
+{
+    Token t = lex.peek();
+    if (t.kind == Tok::Number) {
+        lex.next();
+        emit(Op::PushNum, 0, t.number);
+    } else if (t.kind == Tok::String) {
+        lex.next();
+        emit(Op::PushStr, prog.addString(t.text));
+    } else if (lex.accept("(")) {
+        expression();
+        lex.expect(")");
+    } else if (t.kind == Tok::Ident) {
+        lex.next();
+        if (t.text == "true" || t.text == "false") {
+            emit(Op::PushNum, 0, t.text == "true" ? 1.0 : 0.0);
+        } else if (lex.peek().kind == Tok::Punct && lex.peek().text == "(") {
+            call(t.text);
+        } else if (findLocal(t.text) >= 0) {
+            emit(Op::Load, findLocal(t.text));
+        } else if (findVar(t.text) >= 0) {
+            emit(Op::LoadVar, findVar(t.text));
+        } else {
+            lex.fail("unknown name '" + t.text + "'");
+        }
+    } else {
+        lex.fail("expected an expression");
+    }
+}
+
+void Compiler::call(const std::string &name)
+{
+    int line = lex.peek().line;
+    lex.expect("(");
+    int count = 0;
+    if (!lex.accept(")")) {
+        do {
+            expression();
+            ++count;
+        } while (!lex.failed() && lex.accept(","));
+        lex.expect(")");
+    }
+    if (lex.failed()) return;
+
+    int fn = findBuiltin(name);
+    if (fn >= 0) {
+        if (kBuiltins[fn].args != count) {
+            lex.fail("'" + name + "' takes " + std::to_string(kBuiltins[fn].args) + " argument(s)");
+        } else if (pure && !kBuiltins[fn].pure) {
+            lex.fail("'" + name + "' is not allowed here");
+        }
+        emit(Op::Call, fn, count);
+        return;
+    }
+    if (findVar(name) >= 0 || isKeyword(name)) {
+        lex.fail("'" + name + "' is not a function");
+        return;
+    }
+    // Anything else is an event; finish() reports events that never get defined.
+    if (count != 0) lex.fail("event '" + name + "' takes no arguments");
+    if (pure) lex.fail("event '" + name + "' is not allowed here");
+    emit(Op::Event, findEvent(name, line));
+}
+
+// ---------------------------------------------------------------------------
+// Virtual machine
+// ---------------------------------------------------------------------------
+
+namespace {
+
+struct Value {
+    bool isString = false;
+    double number = 0.0;
+    std::string text;
+};
+
+Value num(double n)
+{
+    Value v;
+    v.number = n;
+    return v;
+}
+
+Value str(std::string_view s)
+{
+    Value v;
+    v.isString = true;
+    v.text = s;
+    return v;
+}
+
+bool truthy(const Value &v)
+{
+    return v.isString ? !v.text.empty() : v.number != 0.0;
+}
+
+bool equal(const Value &a, const Value &b)
+{
+    if (a.isString != b.isString) return false;
+    return a.isString ? a.text == b.text : a.number == b.number;
+}
+
+// Prints whole numbers without a decimal point so "<< intValue" output is unchanged.
+void printValue(const Value &v)
+{
+    if (v.isString) {
+        out() << v.text;
+    } else if (std::floor(v.number) == v.number && std::fabs(v.number) < 1e15) {
+        out() << static_cast<long long>(v.number);
+    } else {
+        out() << v.number;
+    }
+}
+
+Value loadVar(int var, const GameState &st, const Player &p)
+{
+    switch (var) {
+    case VarEnergy: return num(p.energy);
+    case VarHealth: return num(p.health);
+    case VarSocial: return num(p.social);
+    case VarAcademic: return num(p.academic);
+    case VarFitness: return num(p.fitness);
+    case VarMoney: return num(p.money);
+    case VarCurrentWeek: return num(st.currentWeek);
+    case VarVisitedGym: return num(st.visitedGym);
+    case VarMetSam: return num(st.metSam);
+    case VarMetRiley: return num(st.metRiley);
+    case VarEmployed: return num(st.employed);
+    case VarSkipNextScenario: return num(st.skipNextScenario);
+    case VarGameOver: return num(st.gameOver);
+    case VarWeek1FriendEventDone: return num(st.week1FriendEventDone);
+    case VarWeek1RouterEventDone: return num(st.week1RouterEventDone);
+    case VarWeek1EveningEventDone: return num(st.week1EveningEventDone);
+    case VarRelationshipPath: return str(st.relationshipPath);
+    default: return str(st.partnerName);
+    }
+}
+
+void storeVar(int var, const Value &v, GameState &st, Player &p)
+{
+    int n = static_cast<int>(v.number);
+    bool b = truthy(v);
+    switch (var) {
+    case VarEnergy: p.energy = n; break;
+    case VarHealth: p.health = n; break;
+    case VarSocial: p.social = n; break;
+    case VarAcademic: p.academic = n; break;
+    case VarFitness: p.fitness = n; break;
+    case VarMoney: p.money = n; break;
+    case VarCurrentWeek: st.currentWeek = n; break;
+    case VarVisitedGym: st.visitedGym = b; break;
+    case VarMetSam: st.metSam = b; break;
+    case VarMetRiley: st.metRiley = b; break;
+    case VarEmployed: st.employed = b; break;
+    case VarSkipNextScenario: st.skipNextScenario = b; break;
+    case VarGameOver: st.gameOver = b; break;
+    case VarWeek1FriendEventDone: st.week1FriendEventDone = b; break;
+    case VarWeek1RouterEventDone: st.week1RouterEventDone = b; break;
+    case VarWeek1EveningEventDone: st.week1EveningEventDone = b; break;
+    case VarRelationshipPath: st.relationshipPath.assign(v.text); break;
+    default: st.partnerName.assign(v.text); break;
+    }
+}
+
+void adjustVar(int var, int delta, Player &p)
+{
+    switch (var) {
+    case VarEnergy: p.adjustEnergy(delta); break;
+    case VarHealth: p.adjustHealth(delta); break;
+    case VarSocial: p.adjustSocial(delta); break;
+    case VarAcademic: p.adjustAcademic(delta); break;
+    case VarFitness: p.adjustFitness(delta); break;
+    default: p.adjustMoney(delta); break;
+    }
+}
+
+// Runs every builtin except the two that wait for input (ask and read), which execute() awaits itself.
+Value callBuiltin(int fn, const Value *args, const Relationships &crels, Player *p, Relationships *rels)
+{
+    switch (fn) {
+    case FnRoll:
+        return num(roll(args[0].number));
+    case FnRand:
+        return num(randomInt());
+    case FnNpcCount:
+        return num(static_cast<double>(crels.npcs.size()));
+    case FnNpcName: {
+        size_t i = static_cast<size_t>(args[0].number);
+        return str(i < crels.npcs.size() ? std::string_view(crels.npcs[i].name) : std::string_view());
+    }
+    case FnNpcAffinity: {
+        size_t i = static_cast<size_t>(args[0].number);
+        return num(i < crels.npcs.size() ? crels.npcs[i].affinity : 0);
+    }
+    case FnSetAffinity: {
+        size_t i = static_cast<size_t>(args[0].number);
+        if (i < rels->npcs.size()) rels->npcs[i].affinity = static_cast<int>(args[1].number);
+        return num(0);
+    }
+    case FnInteract:
+        rels->interactWith(args[0].text, static_cast<int>(args[1].number));
+        return num(0);
+    case FnContains:
+        return num(args[0].text.find(args[1].text) != std::string::npos);
+    case FnMax:
+        return num(std::max(args[0].number, args[1].number));
+    case FnMin:
+        return num(std::min(args[0].number, args[1].number));
+    case FnChance:
+        return num(chance(args[0].number));
+    case FnRandom:
+        return num(randomUnit());
+    case FnSleep:
+        delay(static_cast<int>(args[0].number));
+        return num(0);
+    default:
+        p->clampStats();
+        return num(0);
+    }
+}
+
+// readNumber()
+// The "read()" builtin: a raw read without validation, matching the original "std::cin >> choice" prompts.
+Task<Value> readNumber()
+{
+    int value = 0;
+    out().flush();
+    co_await awaitInput(PromptKind::Number);
+    in() >> value;
+    co_return num(value);
+}
+
+// execute()
+// Runs bytecode from the entry point until Return. A coroutine, so a script that asks the player
+// something parks (with its value stack and locals) until the answer arrives.
+// The mutable pointers are null when evaluating side-effect-free conditions;
+// the compiler guarantees such code never writes.
+Task<Value> execute(const Image &prog, Entry entry,
+                    const GameState &cst, const Player &cp, const Relationships &crels,
+                    GameState *st, Player *p, Relationships *rels)
+{
+    std::vector<Value> stack;
+    stack.reserve(8);
+    std::vector<Value> locals(entry.locals);
+    int pc = entry.pc;
+
+    while (true) {
+        const Instr &in = prog.code[pc++];
+        switch (in.op) {
+        case Op::PushNum:
+            stack.push_back(num(in.num));
+            break;
+        case Op::PushStr:
+            stack.push_back(str(prog.string(in.a)));
+            break;
+        case Op::Load:
+            stack.push_back(locals[in.a]);
+            break;
+        case Op::Store:
+            locals[in.a] = stack.back();
+            stack.pop_back();
+            break;
+        case Op::LoadVar:
+            stack.push_back(loadVar(in.a, cst, cp));
+            break;
+        case Op::StoreVar:
+            storeVar(in.a, stack.back(), *st, *p);
+            stack.pop_back();
+            break;
+        case Op::AdjustVar:
+            adjustVar(in.a, static_cast<int>(stack.back().number), *p);
+            stack.pop_back();
+            break;
+        case Op::Pop:
+            stack.pop_back();
+            break;
+        case Op::Add:
+        case Op::Sub:
+        case Op::Mul:
+        case Op::Div:
+        case Op::Mod:
+        case Op::Lt:
+        case Op::Le:
+        case Op::Gt:
+        case Op::Ge: {
+            Value b = stack.back();
+            stack.pop_back();
+            Value &a = stack.back();
+            if (in.op == Op::Add && a.isString) {
+                a.text += b.isString ? b.text : std::to_string(static_cast<long long>(b.number));
+                break;
+            }
+            double x = a.number;
+            double y = b.number;
+            double r = 0.0;
+            switch (in.op) {
+            case Op::Add: r = x + y; break;
+            case Op::Sub: r = x - y; break;
+            case Op::Mul: r = x * y; break;
+            case Op::Div: r = x / y; break;
+            case Op::Mod: r = std::fmod(x, y); break;
+            case Op::Lt: r = x < y; break;
+            case Op::Le: r = x <= y; break;
+            case Op::Gt: r = x > y; break;
+            default: r = x >= y; break;
+            }
+            a = num(r);
+            break;
+        }
+        case Op::Eq:
+        case Op::Ne: {
+            Value b = stack.back();
+            stack.pop_back();
+            bool same = equal(stack.back(), b);
+            stack.back() = num(in.op == Op::Eq ? same : !same);
+            break;
+        }
+        case Op::Neg:
+            stack.back() = num(-stack.back().number);
+            break;
+        case Op::Not:
+            stack.back() = num(!truthy(stack.back()));
+            break;
+        case Op::Jump:
+            pc = in.a;
+            break;
+        case Op::JumpIfFalse: {
+            bool t = truthy(stack.back());
+            stack.pop_back();
+            if (!t) pc = in.a;
+            break;
+        }
+        case Op::JumpIfFalseKeep:
+            if (!truthy(stack.back())) pc = in.a;
+            else stack.pop_back();
+            break;
+        case Op::JumpIfTrueKeep:
+            if (truthy(stack.back())) pc = in.a;
+            else stack.pop_back();
+            break;
+        case Op::Call: {
+            int argc = static_cast<int>(in.num);
+            size_t base = stack.size() - argc;
+            Value result;
+            if (in.a == FnAsk) {
+                result = num(co_await promptInt(static_cast<int>(stack[base].number),
+                                                 static_cast<int>(stack[base + 1].number)));
+            } else if (in.a == FnRead) {
+                result = co_await readNumber();
+            } else {
+                result = callBuiltin(in.a, stack.data() + base, crels, p, rels);
+            }
+            stack.resize(base);
+            stack.push_back(result);
+            break;
+        }
+        case Op::Event: {
+            const EventRef &ev = prog.events[in.a];
+            Entry callee;
+            callee.pc = ev.pc;
+            callee.locals = ev.locals;
+            co_await execute(prog, callee, cst, cp, crels, st, p, rels);
+            stack.push_back(num(0));
+            break;
+        }
+        case Op::Say:
+        case Op::Print: {
+            size_t base = stack.size() - in.a;
+            for (size_t i = base; i < stack.size(); ++i) printValue(stack[i]);
+            if (in.op == Op::Say) out() << "\n";
+            stack.resize(base);
+            break;
+        }
+        case Op::Return:
+            co_return stack.empty() ? Value() : stack.back();
+        case Op::SayStr:
+            out() << prog.string(in.a) << "\n";
+            break;
+        case Op::AdjustBy:
+            adjustVar(in.a, static_cast<int>(in.num), *p);
+            break;
+        case Op::SetVar:
+            storeVar(in.a, num(in.num), *st, *p);
+            break;
+        case Op::Interact:
+            rels->interactWith(prog.string(in.a), static_cast<int>(in.num));
+            break;
+        case Op::Roll:
+            stack.push_back(num(roll(in.num)));
+            break;
+        case Op::JumpIfNotNum: {
+            const Value &v = stack.back();
+            bool same = !v.isString && v.number == in.num;
+            stack.pop_back();
+            if (!same) pc = in.a;
+            break;
+        }
+        }
+    }
+}
+
+} // anonymous namespace
+
+// Script::verify()
+// Walks the image once and range-checks each operand against the tables it indexes.
+// Input: image and error string. Output: true when every instruction is valid.
+bool verify(const Image &image, std::string &error)
+{
+    const int codeSize = static_cast<int>(image.codeSize);
+    for (int pc = 0; pc < codeSize; ++pc) {
+        const Instr &in = image.code[pc];
+        bool ok = true;
+        switch (in.op) {
+        case Op::PushStr: ok = in.a >= 0 && static_cast<size_t>(in.a) < image.stringCount; break;
+        case Op::Load:
+        case Op::Store: ok = in.a >= 0; break;
+        case Op::LoadVar:
+        case Op::StoreVar: ok = in.a >= 0 && in.a < VarCount; break;
+        case Op::AdjustVar: ok = in.a >= 0 && isStat(in.a); break;
+        case Op::Jump:
+        case Op::JumpIfFalse:
+        case Op::JumpIfFalseKeep:
+        case Op::JumpIfTrueKeep:
+        case Op::JumpIfNotNum: ok = in.a >= 0 && in.a < codeSize; break;
+        case Op::SayStr:
+        case Op::Interact: ok = in.a >= 0 && static_cast<size_t>(in.a) < image.stringCount; break;
+        case Op::AdjustBy: ok = in.a >= 0 && isStat(in.a); break;
+        case Op::SetVar: ok = in.a >= 0 && in.a < VarRelationshipPath; break;
+        case Op::Call: ok = in.a >= 0 && in.a < FnCount && kBuiltins[in.a].args == static_cast<int>(in.num); break;
+        case Op::Event: ok = in.a >= 0 && static_cast<size_t>(in.a) < image.eventCount; break;
+        case Op::Say:
+        case Op::Print: ok = in.a >= 0; break;
+        case Op::PushNum: case Op::Pop: case Op::Add: case Op::Sub: case Op::Mul: case Op::Div:
+        case Op::Mod: case Op::Neg: case Op::Not: case Op::Eq: case Op::Ne: case Op::Lt:
+        case Op::Le: case Op::Gt: case Op::Ge: case Op::Return: case Op::Roll: break;
+        default: ok = false; break;
+        }
+        if (!ok) {
+            error = "bad instruction at " + std::to_string(pc);
+            return false;
+        }
+    }
+    for (size_t i = 0; i < image.eventCount; ++i) {
+        const EventRef &ev = image.events[i];
+        if (ev.name >= image.stringCount || ev.pc < 0 || ev.pc >= codeSize || ev.locals < 0) {
+            error = "bad event table entry " + std::to_string(i);
+            return false;
+        }
+    }
+    if (codeSize > 0 && image.code[codeSize - 1].op != Op::Return) {
+        error = "bytecode does not end with a return";
+        return false;
+    }
+    return true;
+}
+
+// Script::run()
+// Executes a choice script with full access to the game objects.
+// Input: image, entry, and mutable game objects. Output: game objects updated.
+Task<void> run(const Image &image, Entry entry, GameState &state, Player &player, Relationships &rels)
+{
+    co_await execute(image, entry, state, player, rels, &state, &player, &rels);
+}
+
+// Script::test()
+// Evaluates an availability condition without allowing writes.
+// Input: image, entry, and read-only game objects. Output: true if the condition holds.
+bool test(const Image &image, const Entry &entry, const GameState &state, const Player &player,
+          const Relationships &rels)
+{
+    // Conditions cannot ask for input, so the coroutine always runs to the end.
+    return truthy(runToEnd(execute(image, entry, state, player, rels, nullptr, nullptr, nullptr)));
+}
+
+} // namespace Script
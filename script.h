@@ -0,0 +1,280 @@
+#ifndef SCRIPT_H
+#define SCRIPT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "task.h"
+
+struct GameState;
+class Player;
+class Relationships;
+
+// Effect scripting language used by the scenario content file.
+//
+// Scripts are small C-like programs attached to a choice ("script { ... }"),
+// used as availability conditions ("when <expr>"), or defined as named random
+// events ("event <name> { ... }") that the game and other scripts can trigger.
+// They are compiled once at load time into a flat bytecode Program, stored in
+// the binary content pack, and executed by a stack machine straight from the
+// pack's memory (see Image).
+//
+// Statements:
+//   say <expr>, <expr>...     print the values followed by a newline
+//   print <expr>, <expr>...   print the values with no trailing newline
+//   let <name> = <expr>       declare a block-scoped local
+//   <name> = / += / -= <expr> assign to a local, a GameState flag, or a stat
+//   if <expr> { } else if <expr> { } else { }
+//   for <name> in npcs { }    loop over NPC indices (supports break)
+//   break / return
+//   <call>(<args>)            builtin called for its side effect
+//   <event>()                 run a named event (it may be defined later in the file)
+//
+// Expressions use C operator precedence (?:, ||, &&, ==, <, +, *, unary).
+// Numbers are doubles; comparisons produce 1 or 0. Strings use C escapes and
+// adjacent string literals are concatenated.
+namespace Script {
+
+enum class Op {
+    PushNum,      // push num
+    PushStr,      // push strings[a]
+    Load,         // push locals[a]
+    Store,        // pop into locals[a]
+    LoadVar,      // push game variable a
+    StoreVar,     // pop into game variable a
+    AdjustVar,    // pop delta and apply Player::adjust* for stat a
+    Pop,
+    Add, Sub, Mul, Div, Mod, Neg, Not,
+    Eq, Ne, Lt, Le, Gt, Ge,
+    Jump,         // pc = a
+    JumpIfFalse,  // pop; if falsy pc = a
+    JumpIfFalseKeep, // if top falsy pc = a, else pop (for &&)
+    JumpIfTrueKeep,  // if top truthy pc = a, else pop (for ||)
+    Call,         // builtin a with argument count in num; pushes result
+    Event,        // run events[a]; pushes 0
+    Say,          // pop a values, print them and a newline
+    Print,        // pop a values and print them
+    Return,       // end of script; top of stack is the result when present
+
+    // Superinstructions. The compiler fuses the common sequences on the right into one
+    // instruction so typical effect scripts run without touching the value stack.
+    SayStr,       // print strings[a] and a newline        PushStr; Say 1
+    AdjustBy,     // Player::adjust* stat a by num         PushNum; AdjustVar
+    SetVar,       // game variable a = num                 PushNum; StoreVar
+    Interact,     // interactWith(strings[a], num)         PushStr; PushNum; Call interact; Pop
+    Roll,         // push roll(num)                        PushNum; Call roll
+    JumpIfNotNum  // pop; unless it equals num, pc = a     PushNum; Eq; JumpIfFalse
+};
+
+// Instr
+// One bytecode instruction. Content packs store these as raw 16-byte records, so the layout
+// must stay fixed (bump the pack version when it changes).
+struct Instr {
+    Op op;
+    int32_t a = 0;
+    double num = 0.0;
+};
+
+// EventRef
+// A named event: string-table index of its name and where its script starts. pc is -1 while an
+// event has been called but not yet defined.
+struct EventRef {
+    uint32_t name;
+    int32_t pc;
+    int32_t locals;
+};
+
+// Program
+// Bytecode and interned string constants for every script in one content file, as built by the
+// Compiler. The content compiler also interns scenario text here so the pack has one string table.
+struct Program {
+    std::vector<Instr> code;
+    std::vector<std::string> strings;
+    std::vector<EventRef> events;
+
+    // addString()
+    // Interns a string constant.
+    // Input: string. Output: index of the string in the table.
+    int addString(const std::string &s);
+
+private:
+    std::unordered_map<std::string, int> stringIds;
+};
+
+// StringRef
+// Location of one string inside a text blob.
+struct StringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+// Image
+// Read-only view of compiled bytecode and its string table, usually pointing straight into a
+// memory-mapped content pack. Nothing is copied; the owner of the bytes must outlive the Image.
+struct Image {
+    const Instr *code = nullptr;
+    size_t codeSize = 0;
+    const StringRef *strings = nullptr;
+    size_t stringCount = 0;
+    const char *text = nullptr;
+    const EventRef *events = nullptr;
+    size_t eventCount = 0;
+
+    std::string_view string(size_t i) const
+    {
+        return std::string_view(text + strings[i].offset, strings[i].length);
+    }
+};
+
+// Entry
+// Where a compiled script starts and how many local slots it needs.
+struct Entry {
+    int pc = -1;
+    int locals = 0;
+
+    bool valid() const { return pc >= 0; }
+};
+
+enum class Tok { Ident, Number, String, Punct, End };
+
+struct Token {
+    Tok kind = Tok::End;
+    std::string text; // identifier, punctuation, or decoded string literal
+    double number = 0.0;
+    int line = 1;
+};
+
+// Lexer
+// Splits content text into tokens. '#' starts a comment that runs to the end of the line.
+class Lexer {
+public:
+    explicit Lexer(const std::string &source);
+
+    // peek() / next()
+    // Returns the current token without consuming it, or consumes and returns it.
+    const Token &peek() const { return current; }
+    Token next();
+
+    // accept()
+    // Consumes the current token if it is the given punctuation or identifier.
+    // Input: token text. Output: true if it matched and was consumed.
+    bool accept(const std::string &text);
+
+    // expect()
+    // Like accept(), but records an error when the token does not match.
+    bool expect(const std::string &text);
+
+    // fail()
+    // Records the first error along with the current line number.
+    void fail(const std::string &message);
+
+    // failAt()
+    // Records the first error against an earlier line.
+    void failAt(int line, const std::string &message);
+
+    bool failed() const { return !error.empty(); }
+    const std::string &errorMessage() const { return error; }
+
+private:
+    void advance();
+
+    std::string src;
+    size_t pos = 0;
+    int line = 1;
+    Token current;
+    std::string error;
+};
+
+// Compiler
+// Compiles script blocks and conditions from a Lexer into a shared Program.
+class Compiler {
+public:
+    Compiler(Program &program, Lexer &lexer);
+
+    // compileBlock()
+    // Compiles a "{ statements }" block as a standalone script.
+    // Input: none (reads from the lexer). Output: Entry for the script; invalid on error.
+    Entry compileBlock();
+
+    // compileCondition()
+    // Compiles a single side-effect-free expression used as a choice availability check.
+    // Input: none (reads from the lexer). Output: Entry for the condition; invalid on error.
+    Entry compileCondition();
+
+    // compileEvent()
+    // Compiles a "{ statements }" block as the body of a named event.
+    // Input: event name (already read). Output: true on success; false if the name is taken or the body is invalid.
+    bool compileEvent(const std::string &name);
+
+    // finish()
+    // Reports the first event that was called but never defined.
+    // Input: none. Output: true if every called event exists.
+    bool finish();
+
+private:
+    struct Local {
+        std::string name;
+        int slot;
+    };
+
+    void statement();
+    void block();
+    void ifStatement();
+    void forStatement();
+    void assignment(const std::string &name);
+    void expression();
+    void ternary();
+    void logicalOr();
+    void logicalAnd();
+    void equality();
+    void comparison();
+    void additive();
+    void multiplicative();
+    void unary();
+    void primary();
+    void call(const std::string &name);
+
+    int emit(Op op, int a = 0, double num = 0.0);
+    bool fuse(Op op, int a);
+    void patch(int at);
+    void markTarget(int at);
+    int findEvent(const std::string &name, int line);
+    int findLocal(const std::string &name) const;
+    int declareLocal(const std::string &name);
+
+    Program &prog;
+    Lexer &lex;
+    std::vector<Local> locals;
+    int slotCount = 0;
+    bool pure = false;               // conditions may not change game state
+    std::vector<std::vector<int>> breakJumps;
+    std::vector<int> eventLines;     // line of the first call to each event, for error messages
+    int lastTarget = -1;             // highest instruction index any jump lands on
+};
+
+// verify()
+// Checks that every instruction in an image has a known opcode and in-range operands, so a
+// stale or damaged pack is rejected at load time instead of misbehaving mid-game.
+// Input: image and a string for the error message. Output: true if the bytecode is well formed.
+bool verify(const Image &image, std::string &error);
+
+// run()
+// Executes a compiled script against the live game objects. Scripts that ask the player something
+// park until the answer arrives, so this is a coroutine; co_await it.
+// Input: image, script entry, and the GameState/Player/Relationships to mutate.
+// Output: game objects updated by the script; text printed through out().
+Task<void> run(const Image &image, Entry entry, GameState &state, Player &player, Relationships &rels);
+
+// test()
+// Evaluates a compiled availability condition.
+// Input: image, condition entry, and read-only game objects. Output: truthiness of the result.
+bool test(const Image &image, const Entry &entry, const GameState &state, const Player &player,
+          const Relationships &rels);
+
+} // namespace Script
+
+#endif // SCRIPT_H
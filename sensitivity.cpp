@@ -0,0 +1,345 @@
+#include "sensitivity.h"
+#include "batch.h"
+#include "game.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+namespace Sensitivity {
+
+namespace {
+
+const char *const kDifficultyNames[] = {"", "Easy", "Medium", "Hard"};
+
+// Chance of calling any choice better than a sibling when none is, over a whole run.
+const double kFamilyErrorRate = 0.05;
+
+// How one game ended, in the two measures compared. A game with no outcome (softlocked or
+// stopped) counts as a game over.
+struct Sample {
+    int stars = 0;
+    bool gameOver = true;
+};
+
+// Samples
+// Games indexed by seed offset, one list per policy and difficulty.
+using Samples = std::vector<std::vector<Sample>>;
+
+// ForcedChoice
+// Plays one choice whenever its scenario comes up with it unlocked, and leaves every other
+// decision to the baseline policy. Counts how often it stepped in.
+class ForcedChoice : public Policy {
+public:
+    ForcedChoice(const Policy &base_, int week_, int slot_, int choice_)
+        : base(base_), week(week_), slot(slot_), choice(choice_)
+    {
+    }
+
+    int choose(const Decision &decision, std::mt19937 &random) const override
+    {
+        if (decision.scenario->week == week && decision.scenario->index == slot) {
+            for (int i = 0; i < decision.count; ++i) {
+                if (decision.available[i] == choice) {
+                    forced++;
+                    return i;
+                }
+            }
+        }
+        return base.choose(decision, random);
+    }
+
+    std::string name() const override { return base.name(); }
+
+    long long timesForced() const { return forced.load(); }
+
+private:
+    const Policy &base;
+    int week;
+    int slot;
+    int choice;
+    mutable std::atomic<long long> forced{0};
+};
+
+// play()
+// Plays one batch on one difficulty with the given seed and records every game by its index.
+// Input: options, catalog, policy, difficulty, samples to fill (sized to the game count), game counter.
+void play(const Options &options, const std::shared_ptr<const Content::Catalog> &catalog, const Policy &policy,
+          int difficulty, uint32_t seed, std::vector<Sample> &samples, long long &played)
+{
+    Batch::Options batch;
+    batch.games = options.games;
+    batch.threads = options.threads;
+    batch.policy = &policy;
+    batch.seed = seed;
+    batch.finished = [&samples](int game, const Session &session) {
+        Sample &sample = samples[static_cast<size_t>(game)];
+        if (const Outcome *outcome = session.outcome()) {
+            sample.stars = outcome->stars;
+            sample.gameOver = outcome->gameOver;
+        }
+    };
+    Session::Game game = [difficulty](const Content::Catalog &content) {
+        return runGame(content, std::string(), defaultBalance(), difficulty);
+    };
+    Batch::run(batch, catalog, game);
+    played += options.games;
+}
+
+// paired()
+// Returns the mean and standard error of after - before over every pair in every cell.
+// Input: the two sample sets and which measure to compare. Output: the change.
+Change paired(const Samples &before, const Samples &after, bool gameOver)
+{
+    double sum = 0.0;
+    double squares = 0.0;
+    long long count = 0;
+    for (size_t cell = 0; cell < before.size(); ++cell) {
+        for (size_t i = 0; i < before[cell].size(); ++i) {
+            const Sample &a = before[cell][i];
+            const Sample &b = after[cell][i];
+            double d = gameOver ? static_cast<double>(b.gameOver) - a.gameOver : static_cast<double>(b.stars - a.stars);
+            sum += d;
+            squares += d * d;
+            count++;
+        }
+    }
+    Change change;
+    if (count == 0) return change;
+    change.mean = sum / count;
+    if (count > 1) {
+        double variance = (squares - sum * sum / count) / (count - 1);
+        change.error = std::sqrt(std::max(variance, 0.0) / count);
+    }
+    return change;
+}
+
+// pValue()
+// One-sided p-value that a paired change is really above zero, from the normal approximation.
+// Input: the change. Output: probability of a mean this high if the true change were zero.
+double pValue(const Change &change)
+{
+    if (change.error <= 0.0) return change.mean > 1e-12 ? 0.0 : 1.0;
+    return 0.5 * std::erfc(change.mean / (change.error * std::sqrt(2.0)));
+}
+
+// Test
+// One comparison of two sibling choices (indexes into Result::choices): forcing a instead of b
+// gives more stars, or fewer game overs. Each pair of siblings gets four, both ways round.
+struct Test {
+    size_t a = 0;
+    size_t b = 0;
+    double p = 1.0;
+    bool passed = false;
+};
+
+// compare()
+// Adds the tests between the choices of one scenario. Choices that never came up are left out.
+// Input: first choice and count, effects, forced samples, and the run's tests. Output: tests appended.
+void compare(size_t first, size_t count, const std::vector<ChoiceEffect> &choices,
+             const std::vector<Samples> &samples, std::vector<Test> &tests)
+{
+    for (size_t a = first; a < first + count; ++a) {
+        for (size_t b = first; b < first + count; ++b) {
+            if (a == b || choices[a].forced == 0 || choices[b].forced == 0) continue;
+            Change stars = paired(samples[b], samples[a], false);
+            Change over = paired(samples[b], samples[a], true);
+            over.mean = -over.mean;
+            tests.push_back(Test{a, b, pValue(stars)});
+            tests.push_back(Test{a, b, pValue(over)});
+        }
+    }
+}
+
+// holm()
+// Marks the tests that pass with Holm's step-down correction, which keeps the chance of any false
+// pass at most alpha however many tests there are: taken from the smallest p-value up, the k-th
+// (from 0) of n passes if p <= alpha / (n - k), and the first that fails stops the rest.
+// Input: every test of the run and alpha. Output: passed filled in.
+void holm(std::vector<Test> &tests, double alpha)
+{
+    std::vector<Test *> order;
+    for (Test &test : tests) order.push_back(&test);
+    std::stable_sort(order.begin(), order.end(), [](const Test *x, const Test *y) { return x->p < y->p; });
+    for (size_t k = 0; k < order.size(); ++k) {
+        if (order[k]->p > alpha / static_cast<double>(order.size() - k)) break;
+        order[k]->passed = true;
+    }
+}
+
+// judge()
+// Gives each choice of one scenario its verdict from the tests that passed.
+// Input: first choice and count, effects, and the scenario's tests. Output: verdicts filled in.
+void judge(size_t first, size_t count, std::vector<ChoiceEffect> &choices, const Test *begin, const Test *end)
+{
+    std::vector<char> better(count * count, 0); // better[a * count + b]: a beats b
+    for (const Test *test = begin; test != end; ++test) {
+        if (test->passed) better[(test->a - first) * count + (test->b - first)] = 1;
+    }
+    for (size_t c = 0; c < count; ++c) {
+        ChoiceEffect &effect = choices[first + c];
+        if (effect.forced == 0) {
+            effect.verdict = Verdict::Unused;
+            continue;
+        }
+        bool beatsAll = true;
+        bool compared = false;
+        bool dominated = false;
+        for (size_t s = 0; s < count; ++s) {
+            if (s == c || choices[first + s].forced == 0) continue;
+            compared = true;
+            bool wins = better[c * count + s];
+            bool loses = better[s * count + c];
+            if (!wins || loses) beatsAll = false;
+            if (loses && !wins) dominated = true;
+        }
+        if (compared && beatsAll) {
+            effect.verdict = Verdict::Dominant;
+        } else if (dominated) {
+            effect.verdict = Verdict::Dominated;
+        } else {
+            effect.verdict = Verdict::Mixed;
+        }
+    }
+}
+
+// format()
+// printf into a std::string, for table cells.
+template <typename... Args>
+std::string format(const char *pattern, Args... args)
+{
+    char buffer[256];
+    int n = std::snprintf(buffer, sizeof(buffer), pattern, args...);
+    return std::string(buffer, n > 0 ? std::min(static_cast<size_t>(n), sizeof(buffer) - 1) : 0);
+}
+
+const char *verdictName(Verdict verdict)
+{
+    switch (verdict) {
+    case Verdict::Dominant: return "dominant";
+    case Verdict::Dominated: return "dominated";
+    case Verdict::Unused: return "never unlocked";
+    default: return "";
+    }
+}
+
+} // anonymous namespace
+
+// analyze()
+// Plays a baseline batch per policy and difficulty, then one forced batch per choice on the same
+// seeds. Each batch runs on all workers; the batches run one after another.
+Result analyze(const Options &options, std::shared_ptr<const Content::Catalog> catalog)
+{
+    Result result;
+    auto begin = std::chrono::steady_clock::now();
+    uint32_t seed = options.seed ? options.seed : std::random_device{}();
+    size_t cells = options.policies.size() * options.difficulties.size();
+    auto blank = [&]() { return Samples(cells, std::vector<Sample>(static_cast<size_t>(options.games))); };
+
+    Samples baseline = blank();
+    for (size_t p = 0; p < options.policies.size(); ++p) {
+        for (size_t d = 0; d < options.difficulties.size(); ++d) {
+            play(options, catalog, *options.policies[p], options.difficulties[d], seed,
+                 baseline[p * options.difficulties.size() + d], result.games);
+        }
+    }
+
+    std::vector<Samples> forcedSamples;
+    std::vector<std::pair<size_t, size_t>> scenarioChoices; // first choice and count per scenario
+    for (int week = 1; week <= kSummerWeeks; ++week) {
+        std::pmr::vector<Scenario> scenarios = catalog->loadWeek(week);
+        for (const Scenario &scenario : scenarios) {
+            size_t first = result.choices.size();
+            for (size_t c = 0; c < scenario.choices.size(); ++c) {
+                ChoiceEffect effect;
+                effect.week = scenario.week;
+                effect.slot = scenario.index;
+                effect.choice = static_cast<int>(c);
+                effect.title = std::string(scenario.choices[c].title);
+                Samples forced = blank();
+                for (size_t p = 0; p < options.policies.size(); ++p) {
+                    ForcedChoice policy(*options.policies[p], scenario.week, scenario.index, static_cast<int>(c));
+                    for (size_t d = 0; d < options.difficulties.size(); ++d) {
+                        size_t cell = p * options.difficulties.size() + d;
+                        play(options, catalog, policy, options.difficulties[d], seed, forced[cell], result.games);
+                        Samples one(1, baseline[cell]);
+                        Samples other(1, forced[cell]);
+                        effect.cellStars.push_back(paired(one, other, false).mean);
+                    }
+                    effect.forced += policy.timesForced();
+                }
+                effect.pairs = static_cast<long long>(cells) * options.games;
+                effect.stars = paired(baseline, forced, false);
+                effect.gameOver = paired(baseline, forced, true);
+                result.choices.push_back(std::move(effect));
+                forcedSamples.push_back(std::move(forced));
+            }
+            scenarioChoices.emplace_back(first, result.choices.size() - first);
+        }
+        catalog->releaseWeek(week);
+    }
+
+    // Every comparison of the run is corrected together, so a few hundred of them do not turn
+    // noise into verdicts.
+    std::vector<Test> tests;
+    std::vector<size_t> firstTest;
+    for (const auto &scenario : scenarioChoices) {
+        firstTest.push_back(tests.size());
+        compare(scenario.first, scenario.second, result.choices, forcedSamples, tests);
+    }
+    firstTest.push_back(tests.size());
+    holm(tests, kFamilyErrorRate);
+    for (size_t i = 0; i < scenarioChoices.size(); ++i) {
+        judge(scenarioChoices[i].first, scenarioChoices[i].second, result.choices, tests.data() + firstTest[i],
+              tests.data() + firstTest[i + 1]);
+    }
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    return result;
+}
+
+// print()
+// One row per choice: how often it came up, the paired changes with their standard errors, the
+// verdict, and the change in stars for each policy and difficulty.
+void print(OutputSink &sink, const Options &options, const Result &result)
+{
+    sink << "Choice sensitivity: " << result.games << " games in " << result.seconds << " s, "
+         << (result.choices.empty() ? 0 : result.choices[0].pairs) << " paired games per choice\n";
+    sink << "Changes are forced choice minus the policy's own picks; a game over counts as 0 stars.\n";
+    sink << "Per-cell stars columns:";
+    for (const Policy *policy : options.policies) {
+        for (int difficulty : options.difficulties) {
+            sink << " " << policy->name() << "/" << kDifficultyNames[difficulty];
+        }
+    }
+    sink << "\n";
+    sink << format("%-5s %-36s %8s %16s %18s  %-14s %s\n", "scen", "choice", "forced", "stars", "game over",
+                   "verdict", "stars per cell");
+    for (const ChoiceEffect &effect : result.choices) {
+        std::string row = format("%d.%d   %-36.36s %7.1f%% %+7.3f ±%6.3f %+7.2f%% ±%6.2f%%  %-14s", effect.week,
+                                 effect.slot, effect.title.c_str(),
+                                 effect.pairs ? 100.0 * static_cast<double>(effect.forced) / effect.pairs : 0.0,
+                                 effect.stars.mean, effect.stars.error, 100.0 * effect.gameOver.mean,
+                                 100.0 * effect.gameOver.error, verdictName(effect.verdict));
+        sink << row;
+        for (double cell : effect.cellStars) sink << format(" %+.2f", cell);
+        sink << "\n";
+    }
+
+    sink << "Verdicts use Holm-corrected one-sided tests over every comparison in the run (at most a "
+         << 100 * kFamilyErrorRate << "% chance of any false one).\n";
+    sink << "Dominant choices (clearly better than every alternative):\n";
+    for (const ChoiceEffect &effect : result.choices) {
+        if (effect.verdict == Verdict::Dominant) sink << "  " << effect.week << "." << effect.slot << " " << effect.title << "\n";
+    }
+    sink << "Useless choices (dominated by another choice, or never unlocked):\n";
+    for (const ChoiceEffect &effect : result.choices) {
+        if (effect.verdict == Verdict::Dominated || effect.verdict == Verdict::Unused) {
+            sink << "  " << effect.week << "." << effect.slot << " " << effect.title << " ("
+                 << verdictName(effect.verdict) << ")\n";
+        }
+    }
+}
+
+} // namespace Sensitivity
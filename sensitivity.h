@@ -0,0 +1,80 @@
+#ifndef SENSITIVITY_H
+#define SENSITIVITY_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "catalog.h"
+#include "output.h"
+#include "policy.h"
+
+// Choice sensitivity: what each scenario choice does to how games end. For every choice in the
+// content, bot games are replayed with that choice forced whenever its scenario comes up, and
+// compared game by game with the same games played by the policy alone. Both sides of each pair
+// use the same seed, so they make the same rolls and the same decisions until the forced choice;
+// everything the pair differs in afterwards comes from that choice. This cancels most of the luck
+// that makes unpaired comparisons need far more games.
+namespace Sensitivity {
+
+struct Options {
+    std::vector<const Policy *> policies; // each one is a baseline; at least one
+    std::vector<int> difficulties;        // 1 = Easy, 2 = Medium, 3 = Hard; at least one
+    int games = 200;                      // paired games per choice, per policy and difficulty
+    int threads = 0;                      // scheduler workers; 0 means one per CPU
+    uint32_t seed = 0;                    // first game seed; 0 picks one at random
+};
+
+// Change
+// A mean paired difference and its standard error.
+struct Change {
+    double mean = 0.0;
+    double error = 0.0;
+};
+
+// Verdict
+// How a choice compares with the other choices of its scenario when each is forced. "Better"
+// means more stars or fewer game overs by a paired difference that stays significant after a Holm
+// correction over every comparison in the run, so there is at most a 5% chance of any false verdict.
+enum class Verdict {
+    Mixed,     // better than some choices and worse than others, or no clear difference
+    Dominant,  // better than every other choice and worse than none
+    Dominated, // another choice is better and not worse on either measure
+    Unused     // never came up unlocked, so it changed nothing
+};
+
+// ChoiceEffect
+// The paired effect of forcing one choice, over all policies and difficulties.
+struct ChoiceEffect {
+    int week = 0;
+    int slot = 0;            // scenario within the week, 1-4
+    int choice = 0;          // position in the scenario's full choice list
+    std::string title;
+    long long pairs = 0;     // paired games played
+    long long forced = 0;    // times the choice was forced (it came up unlocked)
+    Change stars;            // change in the final rating; a game over counts as 0 stars
+    Change gameOver;         // change in the chance of a game over
+    std::vector<double> cellStars; // mean change in stars per policy and difficulty (policy-major)
+    Verdict verdict = Verdict::Mixed;
+};
+
+struct Result {
+    std::vector<ChoiceEffect> choices; // in content order
+    long long games = 0;               // games played, including the baselines
+    double seconds = 0.0;
+};
+
+// analyze()
+// Measures every choice in the catalog.
+// Input: options and content snapshot. Output: one effect per choice.
+Result analyze(const Options &options, std::shared_ptr<const Content::Catalog> catalog);
+
+// print()
+// Writes the effects as a table, followed by the dominant and useless choices.
+// Input: destination, the options analyze() was given, and its result. Output: none.
+void print(OutputSink &sink, const Options &options, const Result &result);
+
+} // namespace Sensitivity
+
+#endif // SENSITIVITY_H
@@ -0,0 +1,382 @@
+#include "server.h"
+#include "eventlog.h"
+#include "output.h"
+#include "scheduler.h"
+#include "util.h"
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace Server {
+
+namespace {
+
+const size_t kMaxPendingInput = 64 * 1024;   // unread input before a client is dropped
+const size_t kMaxPendingOutput = 1024 * 1024; // unsent output before a client is dropped
+const int kMaxEvents = 256;
+
+// epoll tags for the non-connection descriptors in a loop.
+char listenTag;
+char watchTag;
+char stopTag;
+
+struct Connection;
+
+// Loop
+// One worker: an epoll set, the settings its sessions share, and the finished sessions it reuses.
+struct Loop {
+    int epollFd = -1;
+    int listenFd = -1;
+    Content::LiveCatalog *content = nullptr;
+    Session::Game game = nullptr;
+    SessionPool sessions;
+    std::unordered_set<Connection *> connections; // open clients, closed at shutdown
+};
+
+// Connection
+// A client socket and the game session that belongs to it.
+struct Connection {
+    Connection(Loop &loop_, int fd_) : loop(loop_), fd(fd_) {}
+
+    Loop &loop;
+    int fd;
+    std::unique_ptr<Session> session;
+    std::string partial;        // received text after the last complete line
+    std::string outbox;
+    size_t sent = 0;            // bytes of outbox already written to the socket
+    bool eof = false;           // peer finished sending
+    bool closed = false;        // socket failed or the peer misbehaved
+    bool waitingOutput = false; // EPOLLOUT is enabled
+};
+
+// Updates which events the loop wants for a connection: input until the peer stops sending,
+// and writability while output is queued.
+void updateInterest(Connection &conn, bool waitOutput)
+{
+    epoll_event ev{};
+    ev.events = conn.eof ? 0u : static_cast<uint32_t>(EPOLLIN | EPOLLRDHUP);
+    if (waitOutput) ev.events |= EPOLLOUT;
+    ev.data.ptr = &conn;
+    epoll_ctl(conn.loop.epollFd, EPOLL_CTL_MOD, conn.fd, &ev);
+    conn.waitingOutput = waitOutput;
+}
+
+// Writes as much pending output as the socket takes.
+void sendOutput(Connection &conn)
+{
+    conn.outbox += conn.session->takeOutput();
+    while (!conn.closed && conn.sent < conn.outbox.size()) {
+        ssize_t n = send(conn.fd, conn.outbox.data() + conn.sent, conn.outbox.size() - conn.sent, MSG_NOSIGNAL);
+        if (n > 0) {
+            conn.sent += static_cast<size_t>(n);
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            if (!conn.waitingOutput) updateInterest(conn, true);
+            break;
+        } else {
+            conn.closed = true;
+        }
+    }
+    if (conn.sent == conn.outbox.size()) {
+        conn.outbox.clear();
+        conn.sent = 0;
+        if (conn.waitingOutput) updateInterest(conn, false);
+    } else if (conn.outbox.size() - conn.sent > kMaxPendingOutput) {
+        conn.closed = true;
+    }
+}
+
+// Closes the socket and returns the session to the loop's pool; a game still in progress is unwound.
+void destroy(Connection *conn)
+{
+    epoll_ctl(conn->loop.epollFd, EPOLL_CTL_DEL, conn->fd, nullptr);
+    close(conn->fd);
+    conn->loop.connections.erase(conn);
+    conn->loop.sessions.recycle(std::move(conn->session));
+    delete conn;
+}
+
+// Sends what the session printed and retires the connection once nothing is left to do: the game
+// ended, or the peer stopped sending and has been given all the output its input produced.
+void settle(Connection *conn)
+{
+    sendOutput(*conn);
+    bool done = conn->session->isFinished() || conn->eof;
+    if (conn->closed || (done && conn->outbox.empty())) destroy(conn);
+}
+
+void acceptClients(Loop &loop)
+{
+    while (true) {
+        int fd = accept4(loop.listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            return; // EAGAIN: another worker took it, or nothing left
+        }
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one)); // fails harmlessly on Unix sockets
+
+        Connection *conn = new Connection(loop, fd);
+        conn->session = loop.sessions.acquire(loop.content->current(), loop.game, true);
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLRDHUP;
+        ev.data.ptr = conn;
+        if (epoll_ctl(loop.epollFd, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            close(fd);
+            loop.sessions.recycle(std::move(conn->session));
+            delete conn;
+            continue;
+        }
+        loop.connections.insert(conn);
+        conn->session->start();
+        settle(conn);
+    }
+}
+
+// Reads everything available and submits each complete line to the session. When the peer stops
+// sending, a final unterminated line still counts.
+void receive(Connection *conn)
+{
+    char buffer[4096];
+    while (true) {
+        ssize_t n = recv(conn->fd, buffer, sizeof(buffer), 0);
+        if (n > 0) {
+            conn->partial.append(buffer, static_cast<size_t>(n));
+            continue;
+        }
+        if (n < 0 && errno == EINTR) continue;
+        if (n == 0) {
+            conn->eof = true;
+            updateInterest(*conn, conn->waitingOutput);
+        } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            conn->closed = true;
+        }
+        break;
+    }
+
+    size_t start = 0;
+    size_t newline;
+    while (!conn->closed && (newline = conn->partial.find('\n', start)) != std::string::npos) {
+        size_t end = newline > start && conn->partial[newline - 1] == '\r' ? newline - 1 : newline;
+        conn->session->submit(std::string_view(conn->partial).substr(start, end - start));
+        start = newline + 1;
+    }
+    conn->partial.erase(0, start);
+    if (conn->eof && !conn->partial.empty()) {
+        conn->session->submit(conn->partial);
+        conn->partial.clear();
+    }
+    if (conn->partial.size() > kMaxPendingInput) conn->closed = true;
+    settle(conn);
+}
+
+// serve()
+// Runs one loop until SIGINT or SIGTERM arrives, then closes its clients (their games are unwound),
+// hands its decision log records to the writer, and returns. The signal is left unread, so every
+// loop sees it.
+void serve(Loop &loop)
+{
+    setDelays(false);
+    epoll_event events[kMaxEvents];
+    bool stopping = false;
+    while (!stopping) {
+        int n = epoll_wait(loop.epollFd, events, kMaxEvents, -1);
+        for (int i = 0; i < n && !stopping; ++i) {
+            void *tag = events[i].data.ptr;
+            if (tag == &stopTag) {
+                stopping = true;
+            } else if (tag == &listenTag) {
+                acceptClients(loop);
+            } else if (tag == &watchTag) {
+                std::string error;
+                if (loop.content->refresh(error)) {
+                    out() << "Content reloaded; new sessions use the updated scenarios.\n";
+                } else if (!error.empty()) {
+                    out() << "Content reload failed, keeping the current version: " << error << "\n";
+                }
+                out().flush();
+            } else {
+                Connection *conn = static_cast<Connection *>(tag);
+                if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                    receive(conn); // may destroy conn
+                } else if (events[i].events & EPOLLOUT) {
+                    settle(conn);
+                }
+            }
+        }
+    }
+    while (!loop.connections.empty()) destroy(*loop.connections.begin());
+    EventLog::flush();
+}
+
+// Opens a non-blocking listening socket for "PORT", "HOST:PORT", or "unix:PATH".
+int listenOn(const std::string &address, std::string &error)
+{
+    if (address.compare(0, 5, "unix:") == 0) {
+        std::string path = address.substr(5);
+        sockaddr_un addr{};
+        if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+            error = "bad unix socket path '" + path + "'";
+            return -1;
+        }
+        addr.sun_family = AF_UNIX;
+        std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+        int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        unlink(path.c_str());
+        if (fd < 0 || bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) < 0 || listen(fd, SOMAXCONN) < 0) {
+            error = address + ": " + std::strerror(errno);
+            if (fd >= 0) close(fd);
+            return -1;
+        }
+        return fd;
+    }
+
+    size_t colon = address.rfind(':');
+    std::string host = colon == std::string::npos ? std::string() : address.substr(0, colon);
+    std::string port = colon == std::string::npos ? address : address.substr(colon + 1);
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = AI_PASSIVE;
+    addrinfo *found = nullptr;
+    int rc = getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(), &hints, &found);
+    if (rc != 0) {
+        error = address + ": " + gai_strerror(rc);
+        return -1;
+    }
+    int fd = -1;
+    for (addrinfo *ai = found; ai && fd < 0; ai = ai->ai_next) {
+        fd = socket(ai->ai_family, ai->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, ai->ai_protocol);
+        if (fd < 0) continue;
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        if (bind(fd, ai->ai_addr, ai->ai_addrlen) < 0 || listen(fd, SOMAXCONN) < 0) {
+            error = address + ": " + std::strerror(errno);
+            close(fd);
+            fd = -1;
+        }
+    }
+    freeaddrinfo(found);
+    return fd;
+}
+
+// Every session holds a socket, so allow as many descriptors as the hard limit permits.
+void raiseDescriptorLimit()
+{
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+// closeAll()
+// Closes the loops' epoll sets, the listening socket, and the signal descriptor.
+void closeAll(const std::vector<std::unique_ptr<Loop>> &loops, int listenFd, int stopFd)
+{
+    for (const std::unique_ptr<Loop> &loop : loops) {
+        if (loop->epollFd >= 0) close(loop->epollFd);
+    }
+    if (listenFd >= 0) close(listenFd);
+    if (stopFd >= 0) close(stopFd);
+}
+
+} // anonymous namespace
+
+// Server::run()
+// Sets up the listener and one epoll loop per worker; the calling thread becomes the first worker
+// and also watches the content files. SIGINT and SIGTERM are blocked and taken through a signalfd
+// in every loop's epoll set, so a stop request ends all loops; the workers are joined and the
+// signal is consumed before the old signal mask comes back.
+// Input: options, live content, session function, error string. Output: false if startup failed.
+bool run(const Options &options, Content::LiveCatalog &content, Session::Game game, std::string &error)
+{
+    signal(SIGPIPE, SIG_IGN);
+    raiseDescriptorLimit();
+    int listenFd = listenOn(options.address, error);
+    if (listenFd < 0) return false;
+
+    sigset_t stopSignals;
+    sigset_t previousMask;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stopSignals, &previousMask); // inherited by the worker threads
+    std::vector<std::unique_ptr<Loop>> loops;
+    int stopFd = signalfd(-1, &stopSignals, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (stopFd < 0) {
+        error = std::string("signalfd: ") + std::strerror(errno);
+        closeAll(loops, listenFd, stopFd);
+        pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+        return false;
+    }
+
+    int threads = options.threads > 0 ? options.threads : static_cast<int>(std::thread::hardware_concurrency());
+    if (threads < 1) threads = 1;
+    for (int i = 0; i < threads; ++i) {
+        std::unique_ptr<Loop> loop(new Loop());
+        loop->epollFd = epoll_create1(EPOLL_CLOEXEC);
+        loop->listenFd = listenFd;
+        loop->content = &content;
+        loop->game = game;
+        loops.push_back(std::move(loop));
+        int epollFd = loops.back()->epollFd;
+        epoll_event ev{};
+        ev.events = EPOLLIN | EPOLLEXCLUSIVE; // wake one worker per incoming connection
+        ev.data.ptr = &listenTag;
+        epoll_event stop{};
+        stop.events = EPOLLIN; // level-triggered and never read here, so it wakes every loop
+        stop.data.ptr = &stopTag;
+        if (epollFd < 0 || epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev) < 0 ||
+            epoll_ctl(epollFd, EPOLL_CTL_ADD, stopFd, &stop) < 0) {
+            error = std::string("epoll: ") + std::strerror(errno);
+            closeAll(loops, listenFd, stopFd);
+            pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+            return false;
+        }
+    }
+
+    int watchFd = content.watch();
+    if (watchFd >= 0) {
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.ptr = &watchTag;
+        epoll_ctl(loops[0]->epollFd, EPOLL_CTL_ADD, watchFd, &ev);
+    }
+
+    std::vector<std::thread> workers;
+    for (int i = 1; i < threads; ++i) {
+        Loop *loop = loops[i].get();
+        workers.emplace_back([loop, i]() {
+            Scheduler::pinToCore(i);
+            serve(*loop);
+        });
+    }
+    if (threads > 1) Scheduler::pinToCore(0); // a connection never leaves its loop, so keep loops on their cores
+    serve(*loops[0]);
+    for (std::thread &worker : workers) worker.join();
+
+    signalfd_siginfo info;
+    while (read(stopFd, &info, sizeof(info)) == static_cast<ssize_t>(sizeof(info))) {
+    }
+    closeAll(loops, listenFd, stopFd);
+    pthread_sigmask(SIG_SETMASK, &previousMask, nullptr);
+    if (options.address.compare(0, 5, "unix:") == 0) unlink(options.address.c_str() + 5);
+    return true;
+}
+
+} // namespace Server
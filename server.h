@@ -0,0 +1,33 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <string>
+
+#include "catalog.h"
+#include "session.h"
+
+// Multi-session game server.
+//
+// Each connection plays its own game as a Session on a single-threaded epoll loop: every line the
+// client sends is submitted to the session, which runs to its next decision point, and the text it
+// printed is sent back. An idle player costs a parked session and a socket rather than a thread.
+// One loop runs per worker thread and the workers share the listening socket. Every session keeps
+// the content catalog it started with, and the first worker reloads the content when
+// scenarios.txt or scenarios.pack changes on disk.
+namespace Server {
+
+struct Options {
+    std::string address; // "PORT", "HOST:PORT", or "unix:PATH"
+    int threads = 0;     // worker loops; 0 means one per CPU
+};
+
+// run()
+// Listens on the given address and serves sessions until SIGINT or SIGTERM arrives, then closes
+// every client (unwinding their games), joins the workers, and returns.
+// Input: options, live content, function that plays one game, and a string for the error message.
+// Output: false if the server could not start (bad address, socket errors), true after a stop signal.
+bool run(const Options &options, Content::LiveCatalog &content, Session::Game game, std::string &error);
+
+} // namespace Server
+
+#endif // SERVER_H
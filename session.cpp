@@ -0,0 +1,222 @@
+#include "session.h"
+#include <iostream>
+
+// Session::Session()
+// Stores the game and its content; the game is created by start().
+Session::Session(std::shared_ptr<const Content::Catalog> catalog_, Game game_, bool captureOutput)
+    : catalog(std::move(catalog_)), game(std::move(game_)), stream(&input),
+      sink(captureOutput ? static_cast<OutputSink *>(&capture) : &discard)
+{
+}
+
+// Session::reset()
+// Destroys the old game's frames before rewinding the arena they live in.
+void Session::reset(std::shared_ptr<const Content::Catalog> catalog_, Game game_, bool captureOutput)
+{
+    task = Task<void>();
+    arena.release();
+    parked = nullptr;
+    prompt = Prompt();
+    started = false;
+    ended = false;
+    weeksEnded = 0;
+    seeded = false;
+    logGame = 0;
+    traceTrack = 0;
+#ifdef SUMMER_PROFILE
+    clock = Profile::Clock();
+#endif
+    input.clear();
+    stream.clear();
+    capture.clear();
+    sink = captureOutput ? static_cast<OutputSink *>(&capture) : &discard;
+    game = std::move(game_);
+    catalog = std::move(catalog_);
+}
+
+// Session::seed()
+// Makes the streams the first time a session is seeded.
+void Session::seed(uint32_t value)
+{
+    if (!random) random.reset(new GameRandom());
+    random->seed(value);
+    seeded = true;
+    seedValue = value;
+}
+
+// Session::start()
+// Creates the game coroutine and runs it to its first prompt.
+void Session::start()
+{
+    if (started) return;
+    started = true;
+    logGame = EventLog::newGame(seeded ? seedValue : 0);
+    std::pmr::memory_resource *previousMemory = setSessionMemory(&arena);
+    task = game(*catalog);
+    setSessionMemory(previousMemory);
+    resume(nullptr);
+}
+
+// Session::submit()
+// Formats the choice as a line and submits it.
+void Session::submit(int choice)
+{
+    submit(std::to_string(choice));
+}
+
+// Session::submit()
+// Appends the line and, once the parked read has a complete answer, lets the game consume it.
+void Session::submit(std::string_view line)
+{
+    if (!started || task.done()) return;
+    input.append(line);
+    input.append("\n");
+    if (parked && hasAnswer(prompt.kind)) {
+        std::coroutine_handle<> reader = std::exchange(parked, nullptr);
+        resume(reader);
+    }
+}
+
+// Session::takeOutput()
+// Moves the captured text out of the session.
+std::string Session::takeOutput()
+{
+    return capture.take();
+}
+
+// Session::hasAnswer()
+// A "press Enter" read needs one line; the others skip whitespace first, so they need a line that
+// holds something besides blanks (a lone Enter at a number prompt waits for the next line, as at
+// the terminal).
+bool Session::hasAnswer(PromptKind kind) const
+{
+    std::string_view text = input.unread();
+    if (kind == PromptKind::Continue) return text.find('\n') != std::string_view::npos;
+    size_t first = text.find_first_not_of(" \t\r\n\v\f");
+    return first != std::string_view::npos && text.find('\n', first) != std::string_view::npos;
+}
+
+// Session::wait()
+// Remembers the read that parked and what it asked for.
+void Session::wait(std::coroutine_handle<> reader, const Prompt &asked)
+{
+    parked = reader;
+    prompt = asked;
+}
+
+// Session::gameEnded()
+// Keeps the outcome; the relationships it points at belong to the game.
+void Session::gameEnded(const Outcome &outcome)
+{
+    result = outcome;
+    result.rels = nullptr;
+    ended = true;
+    if (logGame) EventLog::end(logGame, outcome);
+}
+
+// Session::weekEnded()
+// Keeps the week's closing stats.
+void Session::weekEnded(int week, const Player &player)
+{
+    if (week < 1 || week > kSummerWeeks) return;
+    weekly[week] = player;
+    weeksEnded |= 1u << week;
+}
+
+// Session::choiceMade()
+// Logs the choice when a decision log is open.
+void Session::choiceMade(int week, int slot, int choice, int available, const Player &before, const Player &after)
+{
+    if (logGame) EventLog::choice(logGame, week, slot, choice, available, before, after);
+}
+
+// Session::eventRan()
+// Logs the event when a decision log is open.
+void Session::eventRan(int week, std::string_view name, const Player &before, const Player &after)
+{
+    if (logGame) EventLog::event(logGame, week, name, before, after);
+}
+
+// Session::resume()
+// Runs the game with in()/out() and its allocations pointed at this session until it parks or ends.
+// Input: the parked read to continue, or nullptr to start the game.
+void Session::resume(std::coroutine_handle<> handle)
+{
+    OutputSink *previousOut = setOutput(sink);
+    std::istream *previousIn = &in();
+    setInput(&stream, this);
+    bool previousDelays = setDelays(false);
+    std::pmr::memory_resource *previousMemory = setSessionMemory(&arena);
+    GameObserver *previousObserver = setGameObserver(this);
+    GameRandom *previousRandom = setGameRandom(seeded ? random.get() : nullptr);
+    if (!traceTrack && Trace::enabled()) traceTrack = Trace::newTrack();
+    int previousTrack = Trace::setTrack(traceTrack);
+    uint64_t sliceBegin = traceTrack ? Trace::now() : 0;
+#ifdef SUMMER_PROFILE
+    if (clock.parkedSince) clock.parked += Profile::now() - clock.parkedSince;
+    Profile::Clock *previousClock = Profile::setClock(&clock);
+#endif
+    if (handle) {
+        handle.resume();
+    } else {
+        task.start();
+    }
+#ifdef SUMMER_PROFILE
+    Profile::setClock(previousClock);
+    clock.parkedSince = Profile::now();
+#endif
+    Trace::setTrack(previousTrack);
+    if (sliceBegin) Trace::record("run", sliceBegin, Trace::now(), "session", traceTrack);
+    setGameRandom(previousRandom);
+    setGameObserver(previousObserver);
+    setSessionMemory(previousMemory);
+    setDelays(previousDelays);
+    setInput(previousIn == &std::cin ? nullptr : previousIn);
+    setOutput(previousOut); // flushes the last frame into the capture
+    if (task.done()) prompt = Prompt();
+}
+
+// Session::InputBuffer::append()
+// Adds text, dropping what the game already consumed.
+void Session::InputBuffer::append(std::string_view text)
+{
+    data.erase(0, static_cast<size_t>(gptr() - eback()));
+    data.append(text);
+    setg(&data[0], &data[0], &data[0] + data.size());
+}
+
+// Session::InputBuffer::clear()
+// Forgets all input but keeps the buffer's capacity.
+void Session::InputBuffer::clear()
+{
+    data.clear();
+    setg(nullptr, nullptr, nullptr);
+}
+
+// Session::InputBuffer::underflow()
+// Nothing left to read. Only reached if the game reads more than the answer it waited for.
+Session::InputBuffer::int_type Session::InputBuffer::underflow()
+{
+    return gptr() == egptr() ? traits_type::eof() : traits_type::to_int_type(*gptr());
+}
+
+// SessionPool::acquire()
+// Reuses the most recently returned session, whose memory is the most likely to still be cached.
+std::unique_ptr<Session> SessionPool::acquire(std::shared_ptr<const Content::Catalog> catalog, Session::Game game,
+                                              bool captureOutput)
+{
+    if (idle.empty()) return std::unique_ptr<Session>(new Session(std::move(catalog), std::move(game), captureOutput));
+    std::unique_ptr<Session> session = std::move(idle.back());
+    idle.pop_back();
+    session->reset(std::move(catalog), std::move(game), captureOutput);
+    return session;
+}
+
+// SessionPool::recycle()
+// Ends the game now rather than at the next acquire(), so an idle session holds no game state.
+void SessionPool::recycle(std::unique_ptr<Session> session)
+{
+    if (!session || idle.size() >= limit) return;
+    session->reset(nullptr, nullptr, false);
+    idle.push_back(std::move(session));
+}
@@ -0,0 +1,197 @@
+#ifndef SESSION_H
+#define SESSION_H
+
+#include <coroutine>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arena.h"
+#include "catalog.h"
+#include "eventlog.h"
+#include "output.h"
+#include "profile.h"
+#include "scenario.h"
+#include "task.h"
+#include "trace.h"
+#include "util.h"
+
+// Session
+// One game that is driven step by step instead of owning the console. start() runs the game up to
+// its first decision point; submit() answers that decision and runs to the next one. In between,
+// pendingPrompt() says what is being asked and takeOutput() returns what the game printed, so a
+// server, a bot, or a batch engine can interleave thousands of sessions on one thread.
+//
+// The game is a coroutine (Task) that reads with in() and prints with out(). Before each read it
+// asks the session whether an answer is buffered; if not, it parks in its heap frames until
+// submit() supplies one. A parked session costs only those frames. Pauses are skipped. The session
+// keeps its catalog alive until it is destroyed.
+//
+// Everything the game allocates while it runs (coroutine frames, the relationship list, the week's
+// scenarios) comes from the session's arena, which is freed in one piece with the session.
+class Session : private InputSource, private GameObserver {
+public:
+    // Game
+    // Plays one game using in()/out(), e.g. runGame with saving disabled. It may carry a small
+    // context such as the balance a tuning run is trying, which must outlive the session.
+    using Game = std::function<Task<void>(const Content::Catalog &catalog)>;
+
+    // Session()
+    // Prepares a game; nothing runs until start().
+    // Input: content snapshot, game function, and whether to keep the printed text (false discards
+    // it without formatting).
+    Session(std::shared_ptr<const Content::Catalog> catalog, Game game, bool captureOutput = true);
+
+    // ~Session()
+    // A game still waiting for input is destroyed with its frames; its destructors run.
+    ~Session() override = default;
+
+    Session(const Session &) = delete;
+    Session &operator=(const Session &) = delete;
+
+    // reset()
+    // Ends the current game (as the destructor would) and prepares a new one, keeping the arena's
+    // first block and the input and output buffers so a recycled session allocates nothing.
+    // Input: same as the constructor. Output: none.
+    void reset(std::shared_ptr<const Content::Catalog> catalog, Game game, bool captureOutput = true);
+
+    // seed()
+    // Gives the game its own random streams (see GameRandom in util.h), so two sessions seeded
+    // alike and given the same answers play the same game. Unseeded sessions use the thread's
+    // generator. Call before start(); reset() drops the seed.
+    // Input: seed. Output: none.
+    void seed(uint32_t value);
+
+    // gameSeed()
+    // Returns the seed given to seed(), or 0 for an unseeded session.
+    uint32_t gameSeed() const { return seeded ? seedValue : 0; }
+
+    // start()
+    // Runs the game until it first needs input or ends.
+    // Input: none. Output: none.
+    void start();
+
+    // pendingPrompt()
+    // Returns what the game is waiting for; kind is PromptKind::None once it has finished.
+    const Prompt &pendingPrompt() const { return prompt; }
+
+    // submit()
+    // Gives the game one line of input and runs it to its next decision point. Invalid answers
+    // are handled by the game as at the terminal (it re-prompts).
+    // Input: the player's choice or a raw line. Output: none.
+    void submit(int choice);
+    void submit(std::string_view line);
+
+    // isFinished()
+    // Returns true once the game function has returned.
+    bool isFinished() const { return started && task.done(); }
+
+    // outcome()
+    // Returns how the game ended, or nullptr if it has not reached its ending (still running, or
+    // stopped early, e.g. saved and quit). Outcome::rels is not kept.
+    const Outcome *outcome() const { return ended ? &result : nullptr; }
+
+    // weekStats()
+    // Returns the player's stats at the end of a week, or nullptr if the game did not finish that
+    // week (not reached yet, ended earlier, or skipped by loading a save).
+    // Input: week, 1 to kSummerWeeks. Output: the stats or nullptr.
+    const Player *weekStats(int week) const
+    {
+        return week >= 1 && week <= kSummerWeeks && (weeksEnded >> week & 1u) ? &weekly[week] : nullptr;
+    }
+
+    // memoryUsed()
+    // Returns the bytes the game has taken from the session arena.
+    size_t memoryUsed() const { return arena.used(); }
+
+    // takeOutput()
+    // Returns the text printed since the last call and clears it.
+    // Input: none. Output: printed text (always empty when output is not captured).
+    std::string takeOutput();
+
+private:
+    // InputBuffer
+    // Stream buffer over the submitted lines. It never blocks: the game only reads once
+    // hasAnswer() says a complete answer is buffered.
+    class InputBuffer : public std::streambuf {
+    public:
+        void append(std::string_view text);
+        void clear();
+        std::string_view unread() const { return std::string_view(gptr(), static_cast<size_t>(egptr() - gptr())); }
+
+    protected:
+        int_type underflow() override;
+
+    private:
+        std::string data;
+    };
+
+    bool hasAnswer(PromptKind kind) const override;
+    void wait(std::coroutine_handle<> reader, const Prompt &asked) override;
+    void gameEnded(const Outcome &outcome) override;
+    void weekEnded(int week, const Player &player) override;
+    void choiceMade(int week, int slot, int choice, int available, const Player &before, const Player &after) override;
+    void eventRan(int week, std::string_view name, const Player &before, const Player &after) override;
+    void resume(std::coroutine_handle<> handle);
+
+    std::shared_ptr<const Content::Catalog> catalog;
+    Game game;
+    InputBuffer input;
+    std::istream stream;
+    CaptureSink capture;
+    NullSink discard;
+    OutputSink *sink;
+    Prompt prompt;
+    bool started = false;
+    bool ended = false;
+    Outcome result;
+    Player weekly[kSummerWeeks + 1];
+    unsigned weeksEnded = 0; // bit n set once week n has ended
+    std::unique_ptr<GameRandom> random; // made on first seed() and kept for reuse; the streams are 5 KB
+    bool seeded = false;
+    uint32_t seedValue = 0;
+    uint32_t logGame = 0; // the game's number in the decision log (see eventlog.h); 0 when not logged
+#ifdef SUMMER_PROFILE
+    Profile::Clock clock; // time parked, left out of the game's phase timers
+#endif
+    int traceTrack = 0; // the game's track in a trace (see trace.h); 0 when not traced
+    std::coroutine_handle<> parked;
+    Arena arena;
+    Task<void> task; // declared last so the game is destroyed before what it uses
+};
+
+// SessionPool
+// Finished sessions kept for reuse, so a burst of new games costs a reset() each instead of
+// building sessions from scratch. A pool is not thread-safe; keep one per thread or per loop.
+class SessionPool {
+public:
+    // SessionPool()
+    // Input: the most idle sessions to keep; extra returned sessions are destroyed.
+    explicit SessionPool(size_t capacity = 256) : limit(capacity) {}
+
+    // acquire()
+    // Returns a session ready to start, recycled when one is available.
+    // Input: same as the Session constructor. Output: the session.
+    std::unique_ptr<Session> acquire(std::shared_ptr<const Content::Catalog> catalog, Session::Game game,
+                                     bool captureOutput = true);
+
+    // recycle()
+    // Takes back a session that is no longer needed; its game is ended right away, which also
+    // drops its hold on the catalog.
+    // Input: the session (may be null). Output: none.
+    void recycle(std::unique_ptr<Session> session);
+
+    // size()
+    // Returns the number of idle sessions.
+    size_t size() const { return idle.size(); }
+
+private:
+    size_t limit;
+    std::vector<std::unique_ptr<Session>> idle;
+};
+
+#endif // SESSION_H
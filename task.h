@@ -0,0 +1,164 @@
+#ifndef TASK_H
+#define TASK_H
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "arena.h"
+
+// Task<T>
+// Coroutine type for game code that may wait for player input. A Task does not start until it is
+// awaited or resumed; awaiting it from another Task runs it and hands back its result. When the
+// innermost Task waits for input (see awaitInput() in util.h) the whole chain of awaiting Tasks is
+// parked in its heap frames, and resuming the innermost one later carries on where it stopped:
+// each finished Task transfers control straight back to the Task that awaited it.
+//
+// Game code uses Tasks only on paths that can reach a prompt; everything else stays an ordinary
+// function. Exceptions are not used by the game, so one escaping a Task terminates the program.
+// Frames are allocated from sessionMemory(), so a session's frames live in its arena.
+template <typename T>
+class Task;
+
+namespace TaskDetail {
+
+// Shared promise behaviour: lazy start, and on completion resume whoever awaited the Task.
+struct PromiseBase {
+    std::coroutine_handle<> continuation;
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> done) noexcept
+        {
+            std::coroutine_handle<> next = done.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    // Each frame starts with the resource it came from, since the frame may be destroyed on a
+    // thread (or at a time) where a different resource is current.
+    static constexpr size_t kHeader = alignof(std::max_align_t);
+
+    static void *operator new(size_t size)
+    {
+        std::pmr::memory_resource *resource = sessionMemory();
+        void *block = resource->allocate(size + kHeader, kHeader);
+        *static_cast<std::pmr::memory_resource **>(block) = resource;
+        return static_cast<std::byte *>(block) + kHeader;
+    }
+
+    static void operator delete(void *frame, size_t size)
+    {
+        void *block = static_cast<std::byte *>(frame) - kHeader;
+        (*static_cast<std::pmr::memory_resource **>(block))->deallocate(block, size + kHeader, kHeader);
+    }
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() const noexcept { std::terminate(); }
+};
+
+template <typename T>
+struct Promise : PromiseBase {
+    std::optional<T> value;
+
+    Task<T> get_return_object();
+    void return_value(T v) { value = std::move(v); }
+    T take() { return std::move(*value); }
+};
+
+template <>
+struct Promise<void> : PromiseBase {
+    Task<void> get_return_object();
+    void return_void() const noexcept {}
+    void take() const noexcept {}
+};
+
+} // namespace TaskDetail
+
+template <typename T>
+class Task {
+public:
+    using promise_type = TaskDetail::Promise<T>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    Task() = default;
+    explicit Task(Handle h) : handle(h) {}
+    Task(Task &&other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+    Task &operator=(Task &&other) noexcept
+    {
+        if (this != &other) {
+            if (handle) handle.destroy();
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    // Destroying an unfinished Task destroys its frame, and with it every Task it is awaiting.
+    ~Task()
+    {
+        if (handle) handle.destroy();
+    }
+
+    // Awaiting a Task starts it and resumes the awaiting coroutine with its result when it is done.
+    bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        handle.promise().continuation = awaiting;
+        return handle;
+    }
+
+    T await_resume() { return handle.promise().take(); }
+
+    // start()
+    // Runs a top-level Task until it first parks for input or finishes.
+    void start() { handle.resume(); }
+
+    // done()
+    // Returns true once the coroutine has returned.
+    bool done() const { return !handle || handle.done(); }
+
+    // result()
+    // Returns the value of a finished Task.
+    T result() { return handle.promise().take(); }
+
+private:
+    Handle handle;
+};
+
+namespace TaskDetail {
+
+template <typename T>
+Task<T> Promise<T>::get_return_object()
+{
+    return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> Promise<void>::get_return_object()
+{
+    return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+} // namespace TaskDetail
+
+// runToEnd()
+// Runs a Task that cannot park (it never waits for input, or input is always available, as at
+// the terminal) and returns its result.
+// Input: the task. Output: its result.
+template <typename T>
+T runToEnd(Task<T> task)
+{
+    task.start();
+    return task.result();
+}
+
+#endif // TASK_H
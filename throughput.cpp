@@ -0,0 +1,123 @@
+// End-to-end throughput benchmark: complete 8-week games played headless by bots, the number we
+// track from release to release. Every run plays the same games: a fixed mix of policies on all
+// three difficulties, each cell seeded from a fixed base. The mix is played once on one worker and
+// once on all of them, and the report gives games per second for both, the median and 99th
+// percentile time of one turn (one answer played through to the next prompt), and the peak
+// resident memory.
+//
+// Build and run with `make bench`, after microbench.
+// Usage: ./throughput [games per cell] [workers]
+// Must run from the directory holding scenarios.txt / scenarios.pack.
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <sys/resource.h>
+#include <thread>
+#include <vector>
+
+#include "batch.h"
+#include "catalog.h"
+#include "game.h"
+#include "policy.h"
+
+namespace {
+
+const char *const kPolicies[] = {"random", "balanced", "greedy:money", "affinity:Alex"};
+const uint32_t kSeed = 20250601;
+const uint32_t kCellSeedStride = 1000003; // keeps the cells' seed ranges apart
+
+// Pass
+// Totals of one pass over the mix.
+struct Pass {
+    long long games = 0;
+    uint64_t decisions = 0;
+    int softlocks = 0;
+    double seconds = 0.0;
+    Analytics::Histogram turnNanos{Batch::kTurnBins, Batch::kTurnBinNanos};
+};
+
+// playMix()
+// Plays every policy on every difficulty with the same seeds each time.
+// Input: catalog, policies, games per cell, and workers. Output: totals.
+Pass playMix(const std::shared_ptr<const Content::Catalog> &catalog, const std::vector<std::unique_ptr<Policy>> &policies,
+             int games, int threads)
+{
+    Pass pass;
+    uint32_t cell = 0;
+    for (const std::unique_ptr<Policy> &policy : policies) {
+        for (int difficulty = 1; difficulty <= Balance::kDifficulties; ++difficulty, ++cell) {
+            Batch::Options options;
+            options.games = games;
+            options.threads = threads;
+            options.policy = policy.get();
+            options.seed = kSeed + cell * kCellSeedStride;
+            options.timeTurns = true;
+            Session::Game game = [difficulty](const Content::Catalog &content) {
+                return runGame(content, std::string(), defaultBalance(), difficulty);
+            };
+            Batch::Result result = Batch::run(options, catalog, game);
+            pass.games += result.games;
+            pass.decisions += result.decisions;
+            pass.softlocks += result.softlocks;
+            pass.seconds += result.seconds;
+            pass.turnNanos.merge(result.turnNanos);
+        }
+    }
+    return pass;
+}
+
+// report()
+// Prints one pass as a row.
+void report(const char *name, int threads, const Pass &pass)
+{
+    double seconds = pass.seconds > 0 ? pass.seconds : 1e-9;
+    std::printf("%-16s %7d %9lld %10.3f %12.0f %14.0f %10d %10d\n", name, threads, pass.games, pass.seconds,
+                static_cast<double>(pass.games) / seconds, static_cast<double>(pass.decisions) / seconds,
+                pass.turnNanos.quantile(0.5), pass.turnNanos.quantile(0.99));
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+    int games = argc > 1 ? std::atoi(argv[1]) : 500;
+    int threads = argc > 2 ? std::atoi(argv[2]) : static_cast<int>(std::thread::hardware_concurrency());
+    if (games < 1) games = 500;
+    if (threads < 1) threads = 1;
+
+    std::string error;
+    std::shared_ptr<const Content::Catalog> catalog = Content::load("scenarios.txt", "scenarios.pack", error);
+    if (!catalog) {
+        std::fprintf(stderr, "Could not load content: %s\n", error.c_str());
+        return 1;
+    }
+    std::vector<std::unique_ptr<Policy>> policies;
+    for (const char *spec : kPolicies) {
+        policies.push_back(makePolicy(spec, error));
+        if (!policies.back()) {
+            std::fprintf(stderr, "%s\n", error.c_str());
+            return 1;
+        }
+    }
+
+    int cells = static_cast<int>(policies.size()) * Balance::kDifficulties;
+    std::printf("Mix: %d policies x %d difficulties, %d games each (%d games), seed %u\n",
+                static_cast<int>(policies.size()), Balance::kDifficulties, games, cells * games, kSeed);
+    std::printf("%-16s %7s %9s %10s %12s %14s %10s %10s\n", "pass", "workers", "games", "seconds", "games/s",
+                "turns/s", "p50 ns", "p99 ns");
+    Pass single = playMix(catalog, policies, games, 1);
+    report("single-threaded", 1, single);
+    Pass multi = playMix(catalog, policies, games, threads);
+    report("multi-threaded", threads, multi);
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    std::printf("Peak RSS: %.1f MB\n", static_cast<double>(usage.ru_maxrss) / 1024.0);
+    if (single.softlocks + multi.softlocks > 0) {
+        std::printf("%d games softlocked\n", single.softlocks + multi.softlocks);
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,236 @@
+#include "trace.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace Trace {
+
+namespace {
+
+const size_t kLabelSize = 32;
+
+// Event
+// One finished span. Names point at string literals; the label is copied.
+struct Event {
+    const char *name = nullptr;
+    const char *argName = nullptr;
+    int arg = 0;
+    int track = 0; // session track, or 0 for the recording thread's track
+    uint64_t begin = 0;
+    uint64_t end = 0;
+    char label[kLabelSize] = {};
+};
+
+// Buffer
+// One thread's ring of events. Only its thread writes it while recording.
+struct Buffer {
+    int thread = 0;
+    std::vector<Event> ring;
+    size_t next = 0;
+    bool wrapped = false;
+};
+
+// Recorder
+// The process's trace: its buffers, where it goes, and when it started. Writes the file at exit
+// if stop() was not called.
+struct Recorder {
+    std::mutex lock;
+    std::string path;
+    size_t capacity = 0;
+    uint64_t origin = 0;
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    std::atomic<bool> active{false};
+    std::atomic<int> tracks{0};
+
+    ~Recorder() { stop(); }
+};
+
+Recorder recorder;
+thread_local Buffer *threadBuffer = nullptr;
+thread_local int currentTrack = 0;
+
+// buffer()
+// Returns the calling thread's buffer, making it on first use.
+Buffer &buffer()
+{
+    if (!threadBuffer) {
+        std::lock_guard<std::mutex> guard(recorder.lock);
+        recorder.buffers.emplace_back(new Buffer());
+        Buffer &made = *recorder.buffers.back();
+        made.thread = static_cast<int>(recorder.buffers.size());
+        made.ring.resize(recorder.capacity);
+        threadBuffer = &made;
+    }
+    return *threadBuffer;
+}
+
+// push()
+// Adds an event to the calling thread's ring, over the oldest one when it is full.
+void push(const Event &event)
+{
+    Buffer &b = buffer();
+    if (b.ring.empty()) return;
+    b.ring[b.next] = event;
+    if (++b.next == b.ring.size()) {
+        b.next = 0;
+        b.wrapped = true;
+    }
+}
+
+// writeString()
+// Writes text as a JSON string.
+void writeString(FILE *file, std::string_view text)
+{
+    std::fputc('"', file);
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            std::fputc('\\', file);
+            std::fputc(c, file);
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            std::fprintf(file, "\\u%04x", c);
+        } else {
+            std::fputc(c, file);
+        }
+    }
+    std::fputc('"', file);
+}
+
+// writeEvent()
+// Writes one span as a complete ("X") event. Session tracks are threads of process 2; the
+// recording threads are threads of process 1.
+void writeEvent(FILE *file, const Event &event, int thread, uint64_t origin)
+{
+    int pid = event.track > 0 ? 2 : 1;
+    int tid = event.track > 0 ? event.track : thread;
+    std::fprintf(file, ",\n{\"name\":");
+    writeString(file, event.name);
+    std::fprintf(file, ",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"thread\":%d", pid,
+                 tid, static_cast<double>(event.begin - origin) / 1000.0,
+                 static_cast<double>(event.end - event.begin) / 1000.0, thread);
+    if (event.argName) std::fprintf(file, ",\"%s\":%d", event.argName, event.arg);
+    if (event.label[0]) {
+        std::fprintf(file, ",\"label\":");
+        writeString(file, std::string_view(event.label, strnlen(event.label, kLabelSize)));
+    }
+    std::fprintf(file, "}}");
+}
+
+// writeName()
+// Writes a metadata event naming a process or thread.
+void writeName(FILE *file, const char *kind, int pid, int tid, const std::string &name)
+{
+    std::fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":", kind, pid, tid);
+    writeString(file, name);
+    std::fprintf(file, "}}");
+}
+
+} // anonymous namespace
+
+// start()
+void start(const std::string &path, size_t spansPerThread)
+{
+    std::lock_guard<std::mutex> guard(recorder.lock);
+    recorder.path = path;
+    recorder.capacity = std::max<size_t>(spansPerThread, 1);
+    recorder.origin = now();
+    recorder.active = true;
+}
+
+// stop()
+// Events are written oldest first within each thread.
+bool stop()
+{
+    if (!recorder.active.exchange(false)) return true;
+    std::lock_guard<std::mutex> guard(recorder.lock);
+    FILE *file = std::fopen(recorder.path.c_str(), "w");
+    if (!file) return false;
+    std::fprintf(file, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    std::fprintf(file, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"threads\"}}");
+    writeName(file, "process_name", 2, 0, "sessions");
+    std::set<int> tracks;
+    for (const std::unique_ptr<Buffer> &b : recorder.buffers) {
+        writeName(file, "thread_name", 1, b->thread, "thread " + std::to_string(b->thread));
+        size_t count = b->wrapped ? b->ring.size() : b->next;
+        size_t first = b->wrapped ? b->next : 0;
+        for (size_t i = 0; i < count; ++i) {
+            const Event &event = b->ring[(first + i) % b->ring.size()];
+            writeEvent(file, event, b->thread, recorder.origin);
+            if (event.track > 0) tracks.insert(event.track);
+        }
+    }
+    for (int track : tracks) writeName(file, "thread_name", 2, track, "session " + std::to_string(track));
+    std::fprintf(file, "\n]}\n");
+    return std::fclose(file) == 0;
+}
+
+// enabled()
+bool enabled()
+{
+    return recorder.active.load(std::memory_order_relaxed);
+}
+
+// now()
+uint64_t now()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// newTrack()
+int newTrack()
+{
+    return ++recorder.tracks;
+}
+
+// setTrack()
+int setTrack(int track)
+{
+    int previous = currentTrack;
+    currentTrack = track;
+    return previous;
+}
+
+// record()
+void record(const char *name, uint64_t begin, uint64_t end, const char *argName, int arg)
+{
+    if (!enabled()) return;
+    Event event;
+    event.name = name;
+    event.argName = argName;
+    event.arg = arg;
+    event.begin = begin;
+    event.end = end;
+    push(event);
+}
+
+// Span::Span()
+Span::Span(const char *name_, const char *argName_, int arg_, std::string_view label_)
+    : name(name_), argName(argName_), arg(arg_), track(currentTrack), label(label_)
+{
+    if (enabled()) begin = now();
+}
+
+// Span::~Span()
+// A span that began before recording started is dropped.
+Span::~Span()
+{
+    if (begin == 0 || !enabled()) return;
+    Event event;
+    event.name = name;
+    event.argName = argName;
+    event.arg = arg;
+    event.track = track;
+    event.begin = begin;
+    event.end = now();
+    size_t n = std::min(label.size(), kLabelSize - 1);
+    std::copy(label.begin(), label.begin() + static_cast<std::ptrdiff_t>(n), event.label);
+    push(event);
+}
+
+} // namespace Trace
@@ -0,0 +1,82 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// Timeline tracing in the Chrome trace-event format, for viewing in chrome://tracing or Perfetto.
+// Off unless started (`--trace FILE`); while off, each span costs one relaxed load.
+//
+// Spans are recorded on two kinds of track. A session's track holds its game: each week, scenario,
+// choice, random event, and week end, measured from start to finish, so a span also covers any
+// time the game sat parked while other sessions ran. A thread's track holds what the thread did:
+// the slices in which it ran a session, the time it slept with nothing queued, and waits for a
+// contended queue lock. Gaps between slices on a thread are scheduling overhead.
+//
+// Each thread records into its own ring buffer, so recording never locks; when a buffer is full
+// the oldest spans are overwritten. The buffers are written out by stop(), or when the program
+// exits normally. A process that is killed writes nothing, so a server must be stopped with
+// SIGINT or SIGTERM (which it handles by shutting down) for its trace to be kept.
+namespace Trace {
+
+// start()
+// Starts recording.
+// Input: output path and spans kept per thread. Output: none.
+void start(const std::string &path, size_t spansPerThread = 1 << 16);
+
+// stop()
+// Stops recording and writes the file; later calls do nothing.
+// Input: none. Output: false if the file could not be written.
+bool stop();
+
+// enabled()
+// Returns true while recording.
+bool enabled();
+
+// now()
+// Returns the trace clock in nanoseconds. Input: none. Output: time.
+uint64_t now();
+
+// newTrack()
+// Returns a new session track number (1, 2, ...). Input: none. Output: track.
+int newTrack();
+
+// setTrack()
+// Sets the session track that spans on this thread go to.
+// Input: track, or 0 for the thread's own. Output: the previous track.
+int setTrack(int track);
+
+// record()
+// Records a finished span on the calling thread's track.
+// Input: name (a string literal), begin and end times, and an optional numeric argument. Output: none.
+void record(const char *name, uint64_t begin, uint64_t end, const char *argName = nullptr, int arg = 0);
+
+// Span
+// Records the time from construction to destruction on the session track that was current when
+// it began, or on the thread's track outside a session. The label (e.g. a scenario's location)
+// is copied, truncated to a few dozen characters.
+class Span {
+public:
+    Span(const char *name, const char *argName = nullptr, int arg = 0, std::string_view label = std::string_view());
+    ~Span();
+
+    Span(const Span &) = delete;
+    Span &operator=(const Span &) = delete;
+
+private:
+    const char *name;
+    const char *argName;
+    int arg;
+    int track;
+    uint64_t begin = 0;
+    std::string_view label;
+};
+
+} // namespace Trace
+
+#define TRACE_JOIN_(a, b) a##b
+#define TRACE_JOIN(a, b) TRACE_JOIN_(a, b)
+#define TRACE_SPAN(...) Trace::Span TRACE_JOIN(traceSpan, __LINE__)(__VA_ARGS__)
+
+#endif // TRACE_H
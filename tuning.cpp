@@ -0,0 +1,339 @@
+#include "tuning.h"
+#include "batch.h"
+#include "game.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+
+namespace Tuning {
+
+namespace {
+
+// How strongly candidates are pulled back towards the shipped values: a candidate that moves
+// every parameter by 10% of its range pays about as much as missing a target by 2 points.
+const double kStayWeight = 0.05;
+
+// Games per difficulty in the final comparison, as a multiple of Options::games.
+const int kFinalGamesFactor = 4;
+
+const char *const kDifficultyNames[Balance::kDifficulties + 1] = {"", "easy", "medium", "hard"};
+
+// Slot
+// One tuned number inside a Balance and the range it is searched in. Exactly one of whole and
+// real is set.
+struct Slot {
+    int *whole = nullptr;
+    double *real = nullptr;
+    double low = 0.0;
+    double high = 0.0;
+};
+
+// slots()
+// Lists the tuned numbers of a balance: every decay value, and the multipliers, allowance, and
+// deduction of each targeted difficulty.
+std::vector<Slot> slots(Balance &balance, const std::vector<Target> &targets)
+{
+    std::vector<Slot> list;
+    for (int week = 1; week <= Balance::kWeeks; ++week) {
+        WeekDecay &d = balance.decay[week];
+        for (int *value : {&d.energy, &d.health, &d.social, &d.academic, &d.fitness}) {
+            list.push_back({value, nullptr, -30.0, 0.0});
+        }
+    }
+    for (int level = 1; level <= Balance::kDifficulties; ++level) {
+        bool targeted = std::any_of(targets.begin(), targets.end(),
+                                    [level](const Target &t) { return t.difficulty == level; });
+        if (!targeted) continue;
+        DifficultySettings &s = balance.presets[level].settings;
+        list.push_back({nullptr, &s.energyCostMultiplier, 0.5, 2.0});
+        list.push_back({nullptr, &s.decayMultiplier, 0.5, 2.0});
+        list.push_back({&s.weeklyAllowance, nullptr, 0.0, 200.0});
+        list.push_back({&s.weeklyDeduction, nullptr, 0.0, 200.0});
+    }
+    return list;
+}
+
+// encode()
+// Returns the tuned numbers of a balance, each scaled so its range is [0, 1].
+std::vector<double> encode(Balance balance, const std::vector<Target> &targets)
+{
+    std::vector<double> point;
+    for (const Slot &slot : slots(balance, targets)) {
+        double value = slot.whole ? *slot.whole : *slot.real;
+        point.push_back((value - slot.low) / (slot.high - slot.low));
+    }
+    return point;
+}
+
+// decode()
+// Writes a scaled point into a copy of the shipped balance. Coordinates are clamped to their
+// range; whole numbers are rounded, multipliers are kept to two decimals.
+Balance decode(const std::vector<double> &point, const std::vector<Target> &targets)
+{
+    Balance balance = defaultBalance();
+    std::vector<Slot> list = slots(balance, targets);
+    for (size_t i = 0; i < list.size(); ++i) {
+        double value = list[i].low + std::clamp(point[i], 0.0, 1.0) * (list[i].high - list[i].low);
+        if (list[i].whole) {
+            *list[i].whole = static_cast<int>(std::lround(value));
+        } else {
+            *list[i].real = std::round(value * 100.0) / 100.0;
+        }
+    }
+    return balance;
+}
+
+// measure()
+// Plays the games for every targeted difficulty with the given balance and scores the results.
+// Input: balance, options, catalog, games per difficulty, game seed, and a counter of games played.
+Score measure(const Balance &balance, const Options &options, const std::shared_ptr<const Content::Catalog> &catalog,
+              int games, uint32_t seed, long long &played)
+{
+    Batch::Options batch;
+    batch.games = games;
+    batch.seed = seed;
+    batch.threads = options.threads;
+    batch.policy = options.policy;
+    Batch::Result results[Balance::kDifficulties + 1];
+    for (const Target &target : options.targets) {
+        Batch::Result &result = results[target.difficulty];
+        if (result.games > 0) continue; // already played for an earlier target
+        int level = target.difficulty;
+        Session::Game game = [&balance, level](const Content::Catalog &content) {
+            return runGame(content, std::string(), balance, level);
+        };
+        result = Batch::run(batch, catalog, game);
+        played += result.games;
+    }
+
+    Score score;
+    for (const Target &target : options.targets) {
+        const Batch::Result &result = results[target.difficulty];
+        double ratedShare = static_cast<double>(result.report.rated(target.stars)) / result.games;
+        double survivedShare = static_cast<double>(result.survived) / result.games;
+        score.rated.push_back(ratedShare);
+        score.survived.push_back(survivedShare);
+        if (target.rated >= 0.0) score.loss += (ratedShare - target.rated) * (ratedShare - target.rated);
+        if (target.survived >= 0.0) score.loss += (survivedShare - target.survived) * (survivedShare - target.survived);
+    }
+    return score;
+}
+
+// distance()
+// Returns the mean squared distance between two scaled points.
+double distance(const std::vector<double> &a, const std::vector<double> &b)
+{
+    double total = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        double x = std::clamp(a[i], 0.0, 1.0) - b[i];
+        total += x * x;
+    }
+    return a.empty() ? 0.0 : total / static_cast<double>(a.size());
+}
+
+// parseShare()
+// Reads "0.25" or "25%" as a fraction in [0, 1].
+bool parseShare(std::string_view text, double &share)
+{
+    bool percent = !text.empty() && text.back() == '%';
+    if (percent) text.remove_suffix(1);
+    std::string digits(text);
+    char *end = nullptr;
+    share = std::strtod(digits.c_str(), &end);
+    if (digits.empty() || *end != '\0') return false;
+    if (percent) share /= 100.0;
+    return share >= 0.0 && share <= 1.0;
+}
+
+} // anonymous namespace
+
+// defaultTargets()
+// Medium is the reference: a careful player should nearly always survive the summer and sometimes
+// earn the Balanced ending. Easy forgives more, and Hard should be a coin flip to survive.
+std::vector<Target> defaultTargets()
+{
+    std::vector<Target> targets(3);
+    targets[0].difficulty = 1;
+    targets[0].rated = 0.3;
+    targets[0].survived = 0.97;
+    targets[1].difficulty = 2;
+    targets[1].rated = 0.1;
+    targets[1].survived = 0.85;
+    targets[2].difficulty = 3;
+    targets[2].rated = 0.02;
+    targets[2].survived = 0.5;
+    return targets;
+}
+
+// parseTargets()
+// Items for the same difficulty and star rating are merged into one target.
+bool parseTargets(std::string_view spec, std::vector<Target> &targets, std::string &error)
+{
+    targets.clear();
+    while (!spec.empty()) {
+        size_t comma = spec.find(',');
+        std::string_view item = spec.substr(0, comma);
+        spec = comma == std::string_view::npos ? std::string_view() : spec.substr(comma + 1);
+
+        size_t colon = item.find(':');
+        size_t equals = item.find('=');
+        if (colon == std::string_view::npos || equals == std::string_view::npos || equals < colon) {
+            error = "Bad target '" + std::string(item) + "' (expected DIFFICULTY:KEY=SHARE)";
+            return false;
+        }
+        std::string_view level = item.substr(0, colon);
+        std::string_view key = item.substr(colon + 1, equals - colon - 1);
+        double share = 0.0;
+        int difficulty = 0;
+        for (int i = 1; i <= Balance::kDifficulties; ++i) {
+            if (level == kDifficultyNames[i]) difficulty = i;
+        }
+        if (difficulty == 0) {
+            error = "Unknown difficulty '" + std::string(level) + "' (expected easy, medium, or hard)";
+            return false;
+        }
+        if (!parseShare(item.substr(equals + 1), share)) {
+            error = "Bad share in target '" + std::string(item) + "'";
+            return false;
+        }
+        bool survive = key == "survive";
+        int stars = key.size() == 1 && key[0] >= '1' && key[0] <= '5' ? key[0] - '0' : 0;
+        if (!survive && stars == 0) {
+            error = "Unknown target '" + std::string(key) + "' (expected a star rating 1-5 or survive)";
+            return false;
+        }
+
+        // Join a target of the same difficulty that still has room for this value.
+        Target *joined = nullptr;
+        for (Target &target : targets) {
+            if (target.difficulty != difficulty) continue;
+            if (survive ? target.survived < 0.0 : target.rated < 0.0 || target.stars == stars) joined = &target;
+            if (joined) break;
+        }
+        if (!joined) {
+            targets.emplace_back();
+            joined = &targets.back();
+            joined->difficulty = difficulty;
+        }
+        if (survive) {
+            joined->survived = share;
+        } else {
+            joined->stars = stars;
+            joined->rated = share;
+        }
+    }
+    if (targets.empty()) {
+        error = "No targets given";
+        return false;
+    }
+    return true;
+}
+
+// tune()
+// Separable CMA-ES (Ros and Hansen, 2008) in the scaled [0, 1] coordinates: each generation samples
+// candidates around the mean with a per-coordinate spread, moves the mean towards the best half,
+// and adapts the overall step size from how consistently the mean has been moving. Game outcomes
+// are noisy, so the mean rather than the luckiest candidate is the answer, and candidates that are
+// compared with each other play the same seeds.
+Result tune(const Options &options, std::shared_ptr<const Content::Catalog> catalog)
+{
+    Result result;
+    auto begin = std::chrono::steady_clock::now();
+    const std::vector<double> home = encode(defaultBalance(), options.targets);
+    const int n = static_cast<int>(home.size());
+    const double dims = n;
+
+    // Strategy parameters (the usual defaults, with the covariance rates scaled up for the
+    // diagonal-only model).
+    int lambda = options.population > 1 ? options.population : 4 + static_cast<int>(3 * std::log(dims));
+    int mu = lambda / 2;
+    std::vector<double> weights(static_cast<size_t>(mu));
+    for (int i = 0; i < mu; ++i) weights[i] = std::log(mu + 0.5) - std::log(i + 1.0);
+    double weightSum = std::accumulate(weights.begin(), weights.end(), 0.0);
+    for (double &w : weights) w /= weightSum;
+    double muEff = 0.0;
+    for (double w : weights) muEff += w * w;
+    muEff = 1.0 / muEff;
+    double cSigma = (muEff + 2.0) / (dims + muEff + 5.0);
+    double dSigma = 1.0 + 2.0 * std::max(0.0, std::sqrt((muEff - 1.0) / (dims + 1.0)) - 1.0) + cSigma;
+    double cc = (4.0 + muEff / dims) / (dims + 4.0 + 2.0 * muEff / dims);
+    double c1 = (dims + 2.0) / 3.0 * 2.0 / ((dims + 1.3) * (dims + 1.3) + muEff);
+    double cMu = std::min(1.0 - c1, (dims + 2.0) / 3.0 * 2.0 * (muEff - 2.0 + 1.0 / muEff) /
+                                        ((dims + 2.0) * (dims + 2.0) + muEff));
+    double chiN = std::sqrt(dims) * (1.0 - 1.0 / (4.0 * dims) + 1.0 / (21.0 * dims * dims));
+
+    std::mt19937 random(options.seed ? options.seed : std::random_device{}());
+    std::normal_distribution<double> normal;
+    std::vector<double> mean = home;
+    std::vector<double> spread(home.size(), 1.0); // diagonal of the covariance
+    std::vector<double> pathSigma(home.size(), 0.0);
+    std::vector<double> pathC(home.size(), 0.0);
+    double sigma = options.step;
+
+    struct Candidate {
+        std::vector<double> step; // sampled direction, before sigma
+        double fitness = 0.0;
+        double loss = 0.0;
+    };
+    std::vector<Candidate> candidates(static_cast<size_t>(lambda));
+    for (int generation = 1; generation <= options.generations; ++generation) {
+        // Every candidate of a generation plays the same seeds, so they are ranked on the same luck.
+        uint32_t seed = static_cast<uint32_t>(random()) | 1u;
+        for (Candidate &candidate : candidates) {
+            candidate.step.resize(home.size());
+            std::vector<double> point(home.size());
+            for (int i = 0; i < n; ++i) {
+                candidate.step[i] = std::sqrt(spread[i]) * normal(random);
+                point[i] = mean[i] + sigma * candidate.step[i];
+            }
+            Balance balance = decode(point, options.targets);
+            candidate.loss = measure(balance, options, catalog, options.games, seed, result.games).loss;
+            candidate.fitness = candidate.loss + kStayWeight * distance(point, home);
+            result.candidates++;
+        }
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Candidate &a, const Candidate &b) { return a.fitness < b.fitness; });
+
+        std::vector<double> moved(home.size(), 0.0);
+        for (int k = 0; k < mu; ++k) {
+            for (int i = 0; i < n; ++i) moved[i] += weights[k] * candidates[k].step[i];
+        }
+        double pathLength = 0.0;
+        for (int i = 0; i < n; ++i) {
+            mean[i] = std::clamp(mean[i] + sigma * moved[i], 0.0, 1.0);
+            pathSigma[i] = (1.0 - cSigma) * pathSigma[i] +
+                           std::sqrt(cSigma * (2.0 - cSigma) * muEff) * moved[i] / std::sqrt(spread[i]);
+            pathLength += pathSigma[i] * pathSigma[i];
+        }
+        pathLength = std::sqrt(pathLength);
+        bool steady = pathLength / std::sqrt(1.0 - std::pow(1.0 - cSigma, 2.0 * generation)) <
+                      (1.4 + 2.0 / (dims + 1.0)) * chiN;
+        for (int i = 0; i < n; ++i) {
+            pathC[i] = (1.0 - cc) * pathC[i] + (steady ? std::sqrt(cc * (2.0 - cc) * muEff) * moved[i] : 0.0);
+            double rankMu = 0.0;
+            for (int k = 0; k < mu; ++k) rankMu += weights[k] * candidates[k].step[i] * candidates[k].step[i];
+            spread[i] = (1.0 - c1 - cMu) * spread[i] +
+                        c1 * (pathC[i] * pathC[i] + (steady ? 0.0 : cc * (2.0 - cc) * spread[i])) + cMu * rankMu;
+        }
+        sigma *= std::exp(cSigma / dSigma * (pathLength / chiN - 1.0));
+
+        if (options.log) {
+            *options.log << "generation " << generation << "/" << options.generations << ": best loss "
+                         << candidates[0].loss << ", step " << sigma << ", " << result.games << " games\n";
+            options.log->flush();
+        }
+    }
+
+    result.balance = decode(mean, options.targets);
+    int finalGames = options.games * kFinalGamesFactor;
+    uint32_t finalSeed = static_cast<uint32_t>(random()) | 1u;
+    result.start = measure(defaultBalance(), options, catalog, finalGames, finalSeed, result.games);
+    result.tuned = measure(result.balance, options, catalog, finalGames, finalSeed, result.games);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    return result;
+}
+
+} // namespace Tuning
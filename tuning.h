@@ -0,0 +1,80 @@
+#ifndef TUNING_H
+#define TUNING_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "balance.h"
+#include "catalog.h"
+#include "output.h"
+#include "policy.h"
+
+// Automatic balance tuning. The week decay rows and each difficulty's cost multipliers, allowance,
+// and deduction are searched with a separable CMA-ES (an evolution strategy that adapts its step
+// size and a per-parameter spread as it goes). Every candidate is scored by playing bot games on
+// each targeted difficulty with Batch::run and comparing how they ended with the targets, plus a
+// small penalty for moving away from the shipped values, so parameters the targets do not care
+// about stay where they are. Starting stats and allowanceNeedsGrades are left alone.
+namespace Tuning {
+
+// Target
+// How one difficulty should turn out for the tuning policy. A negative share means no target.
+struct Target {
+    int difficulty = 0;     // 1 = Easy, 2 = Medium, 3 = Hard
+    int stars = 4;          // rating that counts for `rated`
+    double rated = -1.0;    // share of games that end with at least `stars` stars
+    double survived = -1.0; // share of games that reach an ending rather than a game over
+};
+
+struct Options {
+    std::vector<Target> targets;
+    const Policy *policy = nullptr; // plays scenario choices; null picks at random
+    int games = 300;                // games per candidate per targeted difficulty
+    int generations = 20;
+    int population = 0;             // candidates per generation; 0 picks 4 + 3 ln(parameters)
+    double step = 0.1;              // first step size, as a fraction of each parameter's range
+    int threads = 0;                // scheduler workers; 0 means one per CPU
+    uint32_t seed = 0;              // search randomness; 0 picks one at random
+    OutputSink *log = nullptr;      // gets one progress line per generation when set
+};
+
+// Score
+// How a balance did against each target (same order as Options::targets).
+struct Score {
+    double loss = 0.0;
+    std::vector<double> rated;
+    std::vector<double> survived;
+};
+
+struct Result {
+    Balance balance;         // the tuned values
+    Score start;             // the shipped balance, re-measured at the end
+    Score tuned;             // the tuned balance, measured the same way
+    int candidates = 0;      // balances tried
+    long long games = 0;     // bot games played in total
+    double seconds = 0.0;
+};
+
+// defaultTargets()
+// Returns the targets used when none are given, one survival and one 4-star target per difficulty.
+// Input: none. Output: the targets.
+std::vector<Target> defaultTargets();
+
+// parseTargets()
+// Reads targets from a comma-separated list of DIFFICULTY:KEY=SHARE items, where DIFFICULTY is easy,
+// medium, or hard, KEY is a star rating 1-5 (share of games ending with at least that many stars)
+// or "survive", and SHARE is a fraction or a percentage, e.g. "medium:4=25%,medium:survive=0.8".
+// Input: spec, targets to fill, and a string for the error message. Output: false on a bad spec.
+bool parseTargets(std::string_view spec, std::vector<Target> &targets, std::string &error);
+
+// tune()
+// Searches for a balance that meets the targets, starting from the shipped one.
+// Input: options and content snapshot. Output: the tuned balance and how both balances scored.
+Result tune(const Options &options, std::shared_ptr<const Content::Catalog> catalog);
+
+} // namespace Tuning
+
+#endif // TUNING_H
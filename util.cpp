@@ -0,0 +1,275 @@
+#include "util.h"
+#include "output.h"
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <limits>
+#include <thread>
+
+// The C library generator behind chance() and random events is seeded once at startup.
+static bool seed_done = [](){ srand((unsigned)time(nullptr)); return true; }();
+
+// Per-thread console settings; a server thread points these at the session it is running.
+static thread_local std::istream *inputStream = nullptr;
+static thread_local InputSource *inputSource = nullptr;
+static thread_local bool delaysEnabled = true;
+static thread_local GameObserver *observer = nullptr;
+static thread_local GameRandom *gameRandom = nullptr;
+
+// rng()
+// Returns a shared random number generator used for all probabilistic rolls.
+// Input: none. Output: reference to std::mt19937 engine.
+
+/**
+ * rng()
+ * Provides a shared random number generator for probabilistic rolls.
+ * Inputs: None.
+ * Output: Reference to a std::mt19937 random number generator.
+ */
+
+std::mt19937& rng()
+{
+    if (gameRandom) return gameRandom->rolls;
+    static thread_local std::mt19937 gen(std::random_device{}());
+    return gen;
+}
+
+/**
+ * GameRandom::seed()
+ * Seeds the roll and event streams from one value; the two streams get different seed sequences
+ * so they do not repeat each other.
+ * Inputs:
+ *  - value: the game's seed.
+ * Output: None.
+ */
+void GameRandom::seed(uint32_t value)
+{
+    std::seed_seq rollSeed{value, 1u};
+    std::seed_seq eventSeed{value, 2u};
+    rolls.seed(rollSeed);
+    events.seed(eventSeed);
+}
+
+/**
+ * setGameRandom()
+ * Installs the random streams of the game running on this thread.
+ * Inputs:
+ *  - random: the game's streams, or nullptr for none.
+ * Output: The streams that were installed before.
+ */
+GameRandom* setGameRandom(GameRandom* random)
+{
+    GameRandom* previous = gameRandom;
+    gameRandom = random;
+    return previous;
+}
+
+/**
+ * randomInt()
+ * Draws like rand(), from the game's event stream when one is installed.
+ * Inputs: None.
+ * Output: Integer in [0, RAND_MAX].
+ */
+int randomInt()
+{
+    if (!gameRandom) return rand();
+    return std::uniform_int_distribution<int>(0, RAND_MAX)(gameRandom->events);
+}
+
+/**
+ * roll()
+ * Simulates a probabilistic roll and compares the result against a given probability.
+ * Inputs:
+ *  - probability: double in the range [0.0, 1.0] representing the probability of success.
+ * Output: Boolean indicating whether the event occurred (true) or not (false).
+ */
+bool roll(double probability)
+{
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    return dist(rng()) < probability;
+}
+
+/**
+ * randomUnit()
+ * Draws a value from the C library generator used by the random events.
+ * Inputs: None.
+ * Output: Double in the range [0.0, 1.0].
+ */
+double randomUnit()
+{
+    return static_cast<double>(randomInt()) / RAND_MAX;
+}
+
+/**
+ * chance()
+ * Probability roll used by the random events, kept on the C library generator so event
+ * outcomes are independent of the scenario rolls.
+ * Inputs:
+ *  - probability: double in the range [0.0, 1.0].
+ * Output: Boolean indicating whether the event occurred.
+ */
+bool chance(double probability)
+{
+    return randomUnit() < probability;
+}
+
+/**
+ * in()
+ * Returns the current thread's input stream.
+ * Inputs: None.
+ * Output: Reference to the stream, std::cin by default.
+ */
+std::istream& in()
+{
+    return inputStream ? *inputStream : std::cin;
+}
+
+/**
+ * setInput()
+ * Changes where the current thread reads input from.
+ * Inputs:
+ *  - stream: stream to read from, or nullptr for std::cin.
+ *  - source: what fills the stream over time, or nullptr if reads may block.
+ * Output: None.
+ */
+void setInput(std::istream* stream, InputSource* source)
+{
+    inputStream = stream;
+    inputSource = source;
+}
+
+/**
+ * awaitInput()
+ * Builds the awaiter for the next read on the current thread's input.
+ * Inputs:
+ *  - kind, min, max, decision: what is being asked.
+ * Output: Awaiter that parks the caller until an answer is buffered.
+ */
+InputAwaiter awaitInput(PromptKind kind, int min, int max, const Decision* decision)
+{
+    return InputAwaiter{Prompt{kind, min, max, decision}, inputSource};
+}
+
+/**
+ * setDelays()
+ * Enables or disables sleeping in delay() for the current thread.
+ * Inputs:
+ *  - enabled: whether to sleep.
+ * Output: The previous setting, so callers can restore it.
+ */
+bool setDelays(bool enabled)
+{
+    bool previous = delaysEnabled;
+    delaysEnabled = enabled;
+    return previous;
+}
+
+/**
+ * setGameObserver()
+ * Installs the observer for the current thread.
+ * Inputs:
+ *  - next: observer to use, or nullptr.
+ * Output: The previous observer, so callers can restore it.
+ */
+GameObserver* setGameObserver(GameObserver* next)
+{
+    GameObserver* previous = observer;
+    observer = next;
+    return previous;
+}
+
+/**
+ * gameObserver()
+ * Returns the current thread's observer.
+ * Inputs: None.
+ * Output: Observer pointer, or nullptr.
+ */
+GameObserver* gameObserver()
+{
+    return observer;
+}
+
+/**
+ * promptInt()
+ * Prompts the user to input an integer within a specified range.
+ * Inputs:
+ *  - min: integer representing the minimum acceptable value.
+ *  - max: integer representing the maximum acceptable value.
+ *  - decision: the scenario choice being made, if any, passed along with the prompt.
+ * Output: Validated integer input from the user, or min (without further pauses) once the input has ended.
+ */
+
+Task<int> promptInt(int min, int max, const Decision* decision)
+{
+    int value;
+    while (true) {
+        out() << "> ";
+        out().flush();
+        co_await awaitInput(PromptKind::Choice, min, max, decision);
+        if (in() >> value && value >= min && value <= max) {
+            in().ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            delay(1000);
+            co_return value;
+        }
+        if (in().eof()) {
+            // Nothing more will arrive (Ctrl-D, or piped input ran out); asking again would never end.
+            // Nobody is left to watch the rest of the game, so it also skips its pauses.
+            out() << "\nNo more input; choosing " << min << ".\n";
+            setDelays(false);
+            co_return min;
+        }
+        out() << "Please enter a number between " << min << " and " << max << ".\n";
+        in().clear();
+        in().ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+}
+
+/**
+ * delay()
+ * Ends the current output frame so the player sees it, then sleeps.
+ * Inputs:
+ *  - milliseconds: length of the pause.
+ * Output: None.
+ */
+void delay(int milliseconds)
+{
+    out().flush();
+    if (delaysEnabled) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    }
+}
+
+/**
+ * promptChar()
+ * Reads a single-character answer (e.g. y/n) and skips the rest of the line.
+ * Inputs: None.
+ * Output: The character read, or 'n' when the read failed.
+ */
+Task<char> promptChar()
+{
+    char answer = 'n';
+    out().flush();
+    co_await awaitInput(PromptKind::Confirm);
+    if (in() >> answer) {
+        in().ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    } else {
+        in().clear();
+        in().ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    co_return answer;
+}
+
+/**
+ * waitForEnter()
+ * Waits for the user to press Enter to continue.
+ * Inputs: None.
+ * Output: None.
+ */
+Task<void> waitForEnter()
+{
+    out() << "[Press ENTER to continue...]\n";
+    out().flush();
+    co_await awaitInput(PromptKind::Continue);
+    in().ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+}
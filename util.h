@@ -0,0 +1,160 @@
+#ifndef UTIL_H
+#define UTIL_H
+
+#include <coroutine>
+#include <cstdint>
+#include <istream>
+#include <random>
+
+#include "task.h"
+
+// Shared helpers used by the game loop, the random events, and content scripts.
+
+// rng()
+// Returns the random number generator used for all probabilistic rolls (one per thread).
+// Input: none. Output: reference to std::mt19937 engine.
+std::mt19937 &rng();
+
+// GameRandom
+// Random streams that belong to one game. While one is installed with setGameRandom(), rng() and
+// the rand()-based draws (randomUnit(), chance(), and the script rand()) use it instead of the
+// thread's generator and the C library, so a game seeded the same way makes the same rolls
+// wherever and whenever it runs.
+struct GameRandom {
+    std::mt19937 rolls;  // returned by rng()
+    std::mt19937 events; // used in place of rand()
+
+    // seed()
+    // Restarts both streams from one seed. Input: seed. Output: none.
+    void seed(uint32_t value);
+};
+
+// setGameRandom()
+// Installs the current thread's game streams.
+// Input: streams, or nullptr to go back to the thread's generator and rand(). Output: the previous streams.
+GameRandom *setGameRandom(GameRandom *random);
+
+// randomInt()
+// Returns a draw in [0, RAND_MAX], from the installed game's event stream or else from rand().
+// Input: none. Output: the draw.
+int randomInt();
+
+// roll()
+// Returns true with the given probability.
+// Input: probability in [0.0, 1.0]. Output: whether the event occurred.
+bool roll(double probability);
+
+// randomUnit()
+// Returns rand() scaled to [0.0, 1.0], the draw used by the random events.
+// Input: none. Output: double in [0.0, 1.0].
+double randomUnit();
+
+// chance()
+// Returns true with the given probability, drawing from rand() like the random events always have.
+// Input: probability in [0.0, 1.0]. Output: whether the event occurred.
+bool chance(double probability);
+
+// Prompt
+// The kind of answer the game is waiting for, so whoever supplies the input (a terminal, a network
+// session, a bot) can see what is asked.
+enum class PromptKind {
+    None,     // not waiting for input
+    Choice,   // a number in [min, max] (promptInt)
+    Confirm,  // y or n (promptChar)
+    Continue, // just Enter (waitForEnter)
+    Number    // any number, read without validation (the "read()" script builtin)
+};
+
+struct Decision; // scenario.h
+
+struct Prompt {
+    PromptKind kind = PromptKind::None;
+    int min = 0;
+    int max = 0;
+    const Decision *decision = nullptr; // the options behind a scenario choice, for bots
+};
+
+// InputSource
+// Supplies input that arrives over time, such as a network session. Before each read the input
+// helpers ask whether an answer is already buffered; if not, the reading coroutine is handed to
+// the source, which resumes it once the answer has arrived. Without a source (the terminal),
+// reads simply block.
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    // hasAnswer()
+    // Returns true if enough input is buffered to answer a prompt of this kind without blocking.
+    virtual bool hasAnswer(PromptKind kind) const = 0;
+
+    // wait()
+    // Takes a parked reader; the source resumes it when hasAnswer() becomes true.
+    virtual void wait(std::coroutine_handle<> reader, const Prompt &prompt) = 0;
+};
+
+// in()
+// Returns the stream the current thread reads player input from (std::cin unless setInput() changed it).
+// Input: none. Output: reference to the input stream.
+std::istream &in();
+
+// setInput()
+// Redirects the current thread's input, e.g. to a network session.
+// Input: stream to read from (nullptr for std::cin) and the source that fills it, if any. Output: none.
+void setInput(std::istream *stream, InputSource *source = nullptr);
+
+// awaitInput()
+// Waits until an answer to the given prompt can be read from in() without blocking.
+// Usage: co_await awaitInput(prompt); then read from in().
+struct InputAwaiter {
+    Prompt prompt;
+    InputSource *source;
+
+    bool await_ready() const { return !source || source->hasAnswer(prompt.kind); }
+    void await_suspend(std::coroutine_handle<> reader) const { source->wait(reader, prompt); }
+    void await_resume() const {}
+};
+InputAwaiter awaitInput(PromptKind kind, int min = 0, int max = 0, const Decision *decision = nullptr);
+
+// GameObserver
+// Receives structured reports from the game running on this thread, so a headless runner can tally
+// results without reading the text. Defined in scenario.h.
+class GameObserver;
+
+// setGameObserver()
+// Installs the current thread's observer.
+// Input: observer, or nullptr for none. Output: the observer that was active before.
+GameObserver *setGameObserver(GameObserver *observer);
+
+// gameObserver()
+// Returns the current thread's observer, or nullptr.
+GameObserver *gameObserver();
+
+// setDelays()
+// Turns the dramatic pauses in delay() and promptInt() on or off for the current thread.
+// Servers and simulations turn them off; output is still flushed at each pause.
+// Input: true to sleep, false to skip sleeping. Output: the previous setting.
+bool setDelays(bool enabled);
+
+// promptInt()
+// Prompts until the user enters an integer in [min, max]; at end of input it answers min and
+// turns the remaining pauses off.
+// Input: inclusive bounds, and the decision being made when it is a scenario choice (shown to
+// whoever supplies the input). Output: the validated integer.
+Task<int> promptInt(int min, int max, const Decision *decision = nullptr);
+
+// delay()
+// Shows everything printed so far, then pauses for dramatic effect.
+// Input: pause length in milliseconds. Output: none.
+void delay(int milliseconds);
+
+// promptChar()
+// Reads a one-character answer such as y/n and discards the rest of the line.
+// Input: none. Output: the character, or 'n' if nothing could be read.
+Task<char> promptChar();
+
+// waitForEnter()
+// Waits for the user to press Enter to continue.
+// Input: none. Output: none.
+Task<void> waitForEnter();
+
+#endif // UTIL_H